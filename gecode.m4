@@ -583,6 +583,19 @@ AC_DEFUN([AC_GECODE_AUDIT],
         AC_MSG_RESULT(no)
      fi])
 
+AC_DEFUN([AC_GECODE_PROPAGATION_PROFILER],
+    [AC_ARG_ENABLE([propagation-profiler],
+       AC_HELP_STRING([--enable-propagation-profiler],
+         [build with propagation profiler @<:@default=no@:>@]))
+     AC_MSG_CHECKING(whether to build with propagation profiler)
+     if test "${enable_propagation_profiler:-no}" = "yes"; then
+        AC_DEFINE([GECODE_PROPAGATION_PROFILER],[],
+                  [Whether to profile propagation])
+        AC_MSG_RESULT(yes)
+     else
+        AC_MSG_RESULT(no)
+     fi])
+
 
 AC_DEFUN([AC_GECODE_PROFILE],
      [AC_ARG_ENABLE([profile],
@@ -1447,6 +1460,23 @@ AC_DEFUN([AC_GECODE_THREADS],[
   fi
 ])
 
+AC_DEFUN([AC_GECODE_DISTRIBUTED],[
+  AC_MSG_CHECKING([for processes and sockets for distributed search])
+  AC_TRY_LINK([#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <unistd.h>],
+    [int fd[[2]];
+     (void) socketpair(AF_UNIX, SOCK_STREAM, 0, fd);
+     (void) poll(0, 0, 0);
+     (void) waitpid(fork(), 0, 0);],
+    [AC_MSG_RESULT(yes)
+     AC_DEFINE([GECODE_HAS_DISTRIBUTED],[],
+               [Whether distributed search is available])],
+    [AC_MSG_RESULT(no)])
+])
+
 AC_DEFUN([AC_GECODE_TIMER],[
   AC_CHECK_HEADER(sys/time.h,
   [AC_DEFINE(GECODE_USE_GETTIMEOFDAY,1,[Use gettimeofday for time-measurement])],
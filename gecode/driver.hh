@@ -333,6 +333,7 @@ namespace Gecode {
     Driver::BaseOption* fst;   ///< First registered option
     Driver::BaseOption* lst;   ///< Last registered option
     const char* _name; ///< Script name
+    const char** _argv; ///< Arguments (NULL-terminated) passed to parse
   public:
     /// Initialize options for script with name \a s
     BaseOptions(const char* s);
@@ -354,6 +355,8 @@ namespace Gecode {
     const char* name(void) const;
     /// Set name of script
     void name(const char*);
+    /// Return arguments (NULL-terminated) passed to parse (NULL if not parsed)
+    const char* const* argv(void) const;
 
     /// Destructor
     virtual ~BaseOptions(void);
@@ -382,6 +385,9 @@ namespace Gecode {
     Driver::StringOption      _search;        ///< Search options
     Driver::UnsignedIntOption _solutions;     ///< How many solutions
     Driver::DoubleOption      _threads;       ///< How many threads to use
+    Driver::UnsignedIntOption _eps;           ///< Subproblems per thread
+    Driver::UnsignedIntOption _processes;     ///< Worker processes for distributed search
+    Driver::StringValueOption _address;       ///< Address for distributed search
     Driver::UnsignedIntOption _c_d;           ///< Copy recomputation distance
     Driver::UnsignedIntOption _a_d;           ///< Adaptive recomputation distance
     Driver::UnsignedIntOption _d_l;           ///< Discrepancy limit for LDS
@@ -395,10 +401,22 @@ namespace Gecode {
     Driver::UnsignedIntOption _r_scale;       ///< Restart scale factor
     Driver::BoolOption        _nogoods;       ///< Whether to use no-goods
     Driver::UnsignedIntOption _nogoods_limit; ///< Limit for no-good extraction
+    Driver::UnsignedIntOption _nogoods_max;   ///< Maximal number of no-good propagators
     Driver::DoubleOption      _relax;         ///< Probability to relax variable
     Driver::BoolOption        _interrupt;     ///< Whether to catch SIGINT
     //@}
 
+    /// \name Memory options
+    //@{
+    Driver::UnsignedIntOption _hcsz_min;    ///< Minimal heap chunk size
+    Driver::UnsignedIntOption _hcsz_max;    ///< Maximal heap chunk size
+    Driver::UnsignedIntOption _hcsz_inc;    ///< Heap chunk increment ratio
+    Driver::UnsignedIntOption _hcsz_dec;    ///< Heap chunk decrement ratio
+    Driver::UnsignedIntOption _fl_refill;   ///< Free list refill count
+    Driver::UnsignedIntOption _region_size; ///< Size of region area
+    Driver::BoolOption        _mem_adapt;   ///< Whether to adapt chunk sizes
+    //@}
+
     /// \name Execution options
     //@{
     Driver::StringOption      _mode;       ///< Script mode to run
@@ -408,6 +426,10 @@ namespace Gecode {
     Driver::StringValueOption _out_file;   ///< Where to print solutions
     Driver::StringValueOption _log_file;   ///< Where to print statistics
     Driver::TraceOption       _trace;      ///< Trace flags for tracing
+#ifdef GECODE_PROPAGATION_PROFILER
+    Driver::StringValueOption _profile_file;   ///< Where to print profile
+    Driver::StringOption      _profile_format; ///< Format of profile
+#endif
     //@}
 
   public:
@@ -484,6 +506,21 @@ namespace Gecode {
     /// Return number of parallel threads
     double threads(void) const;
 
+    /// Set default number of subproblems per thread
+    void eps(unsigned int n);
+    /// Return number of subproblems per thread
+    unsigned int eps(void) const;
+
+    /// Set default number of worker processes for distributed search
+    void processes(unsigned int n);
+    /// Return number of worker processes for distributed search
+    unsigned int processes(void) const;
+
+    /// Set default address for distributed search
+    void address(const char* a);
+    /// Return address for distributed search
+    const char* address(void) const;
+
     /// Set default copy recomputation distance
     void c_d(unsigned int d);
     /// Return copy recomputation distance
@@ -549,6 +586,11 @@ namespace Gecode {
     /// Return depth limit for nogoods
     unsigned int nogoods_limit(void) const;
 
+    /// Set default maximal number of nogood propagators kept
+    void nogoods_max(unsigned int m);
+    /// Return maximal number of nogood propagators kept
+    unsigned int nogoods_max(void) const;
+
     /// Set default relax probability
     void relax(double d);
     /// Return default relax probability
@@ -560,6 +602,14 @@ namespace Gecode {
     bool interrupt(void) const;
     //@}
 
+    /// \name Memory options
+    //@{
+    /// Set default memory management policy
+    void memory(const MemoryPolicy& mp);
+    /// Return memory management policy
+    MemoryPolicy memory(void) const;
+    //@}
+
     /// \name Execution options
     //@{
     /// Set default mode
@@ -596,6 +646,18 @@ namespace Gecode {
     void trace(int f);
     /// Return trace flags
     int trace(void) const;
+
+#ifdef GECODE_PROPAGATION_PROFILER
+    /// Set default output file name for propagation profile
+    void profile_file(const char* f);
+    /// Get file name for propagation profile (NULL if none)
+    const char* profile_file(void) const;
+
+    /// Set default format for propagation profile
+    void profile_format(ProfileFormat pf);
+    /// Return format for propagation profile
+    ProfileFormat profile_format(void) const;
+#endif
     //@}
 
 #ifdef GECODE_HAS_GIST
@@ -285,6 +285,8 @@ namespace Gecode {
           else if (!strncmp("memory",a,e))   { m |= IPL_MEMORY; }
           else if (!strncmp("basic",a,e))    { m |= IPL_BASIC; }
           else if (!strncmp("advanced",a,e)) { m |= IPL_ADVANCED; }
+          else if (!strncmp("ttef",a,e))     { m |= IPL_TTEF; }
+          else if (!strncmp("energetic",a,e)) { m |= IPL_ENERGETIC; }
           else {
             std::cerr << "Wrong argument \"" << a
                       << "\" for option \"" << opt << "\""
@@ -306,7 +308,8 @@ namespace Gecode {
     IplOption::help(void) {
       using namespace std;
       cerr << '\t' << opt
-           << " (def,val,bnd,dom,speed,memory,basic,advanced)" << endl
+           << " (def,val,bnd,dom,speed,memory,basic,advanced,ttef,energetic)"
+           << endl
            << "\t\tdefault: ";
       switch (vbd(cur)) {
       case IPL_DEF: cerr << "def"; break;
@@ -319,6 +322,8 @@ namespace Gecode {
       if (cur & IPL_MEMORY)   cerr << ",memory";
       if (cur & IPL_BASIC)    cerr << ",basic";
       if (cur & IPL_ADVANCED) cerr << ",advanced";
+      if (cur & IPL_TTEF)     cerr << ",ttef";
+      if (cur & IPL_ENERGETIC) cerr << ",energetic";
       cerr << endl << "\t\t" << exp << endl;
     }
 
@@ -418,7 +423,7 @@ namespace Gecode {
   }
   BaseOptions::BaseOptions(const char* n)
     : fst(NULL), lst(NULL),
-      _name(Driver::BaseOption::strdup(n)) {}
+      _name(Driver::BaseOption::strdup(n)), _argv(NULL) {}
 
   void
   BaseOptions::name(const char* n) {
@@ -475,6 +480,12 @@ namespace Gecode {
 
   void
   BaseOptions::parse(int& argc, char* argv[]) {
+    // Remember the arguments, for example for starting worker processes
+    delete [] _argv;
+    _argv = new const char*[argc+1];
+    for (int i=0; i<argc; i++)
+      _argv[i] = argv[i];
+    _argv[argc] = NULL;
     int c = argc;
     char** v = argv;
   next:
@@ -499,6 +510,7 @@ namespace Gecode {
 
   BaseOptions::~BaseOptions(void) {
     Driver::BaseOption::strdel(_name);
+    delete [] _argv;
   }
 
 
@@ -517,6 +529,11 @@ namespace Gecode {
       _solutions("-solutions","number of solutions (0 = all)",1),
       _threads("-threads","number of threads (0 = #processing units)",
                Search::Config::threads),
+      _eps("-eps","number of subproblems per thread (0 = work stealing only)",
+           0),
+      _processes("-processes",
+                 "number of worker processes (0 = no distributed search)",0),
+      _address("-address","port or socket path for distributed search"),
       _c_d("-c-d","recomputation commit distance",Search::Config::c_d),
       _a_d("-a-d","recomputation adaptation distance",Search::Config::a_d),
       _d_l("-d-l","discrepancy limit for LDS",Search::Config::d_l),
@@ -533,10 +550,28 @@ namespace Gecode {
       _nogoods("-nogoods","whether to use no-goods from restarts",false),
       _nogoods_limit("-nogoods-limit","depth limit for no-good extraction",
                      Search::Config::nogoods_limit),
+      _nogoods_max("-nogoods-max",
+                   "maximal number of no-good propagators kept (0 for no limit)",
+                   0),
       _relax("-relax","probability for relaxing variable", 0.0),
       _interrupt("-interrupt","whether to catch Ctrl-C (true) or not (false)",
                  true),
 
+      _hcsz_min("-hcsz-min","minimal heap chunk size (in bytes)",
+                static_cast<unsigned int>(MemoryConfig::hcsz_min)),
+      _hcsz_max("-hcsz-max","maximal heap chunk size (in bytes)",
+                static_cast<unsigned int>(MemoryConfig::hcsz_max)),
+      _hcsz_inc("-hcsz-inc-ratio","ratio to increase heap chunk size",
+                MemoryConfig::hcsz_inc_ratio),
+      _hcsz_dec("-hcsz-dec-ratio","ratio to decrease heap chunk size",
+                MemoryConfig::hcsz_dec_ratio),
+      _fl_refill("-fl-refill","number of free list elements to allocate",
+                 MemoryConfig::fl_refill),
+      _region_size("-region-size","size of region area (in bytes)",
+                   static_cast<unsigned int>(MemoryConfig::region_area_size)),
+      _mem_adapt("-memory-adaptive",
+                 "whether clones adapt heap chunk size to parent",false),
+
       _mode("-mode","how to execute script",SM_SOLUTION),
       _samples("-samples","how many samples (time mode)",1),
       _iterations("-iterations","iterations per sample (time mode)",1),
@@ -548,6 +583,12 @@ namespace Gecode {
       _log_file("-file-stat", "where to print statistics "
                 "(supports stdout, stdlog, stderr)","stdout"),
       _trace(0)
+#ifdef GECODE_PROPAGATION_PROFILER
+      , _profile_file("-file-profile", "where to print propagation profile "
+                      "(supports stdout, stdlog, stderr)"),
+      _profile_format("-profile-format","format of propagation profile",
+                      PF_CSV)
+#endif
   {
 
     _mode.add(SM_SOLUTION, "solution");
@@ -555,6 +596,11 @@ namespace Gecode {
     _mode.add(SM_STAT, "stat");
     _mode.add(SM_GIST, "gist");
 
+#ifdef GECODE_PROPAGATION_PROFILER
+    _profile_format.add(PF_CSV, "csv");
+    _profile_format.add(PF_JSON, "json");
+#endif
+
     _restart.add(RM_NONE,"none");
     _restart.add(RM_CONSTANT,"constant");
     _restart.add(RM_LINEAR,"linear");
@@ -563,15 +609,22 @@ namespace Gecode {
 
     add(_model); add(_symmetry); add(_propagation); add(_ipl);
     add(_branching); add(_decay); add(_seed); add(_step);
-    add(_search); add(_solutions); add(_threads); add(_c_d); add(_a_d);
+    add(_search); add(_solutions); add(_threads); add(_eps);
+    add(_processes); add(_address);
+    add(_c_d); add(_a_d);
     add(_d_l);
     add(_node); add(_fail); add(_time); add(_interrupt);
     add(_assets); add(_slice);
     add(_restart); add(_r_base); add(_r_scale);
-    add(_nogoods); add(_nogoods_limit);
+    add(_nogoods); add(_nogoods_limit); add(_nogoods_max);
     add(_relax);
+    add(_hcsz_min); add(_hcsz_max); add(_hcsz_inc); add(_hcsz_dec);
+    add(_fl_refill); add(_region_size); add(_mem_adapt);
     add(_mode); add(_iterations); add(_samples); add(_print_last);
     add(_out_file); add(_log_file); add(_trace);
+#ifdef GECODE_PROPAGATION_PROFILER
+    add(_profile_file); add(_profile_format);
+#endif
   }
 
 
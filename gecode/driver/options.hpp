@@ -171,6 +171,11 @@ namespace Gecode {
     return _name;
   }
 
+  inline const char* const*
+  BaseOptions::argv(void) const {
+    return _argv;
+  }
+
 
 
   /*
@@ -301,6 +306,33 @@ namespace Gecode {
     return _threads.value();
   }
 
+  inline void
+  Options::eps(unsigned int n) {
+    _eps.value(n);
+  }
+  inline unsigned int
+  Options::eps(void) const {
+    return _eps.value();
+  }
+
+  inline void
+  Options::processes(unsigned int n) {
+    _processes.value(n);
+  }
+  inline unsigned int
+  Options::processes(void) const {
+    return _processes.value();
+  }
+
+  inline void
+  Options::address(const char* a) {
+    _address.value(a);
+  }
+  inline const char*
+  Options::address(void) const {
+    return _address.value();
+  }
+
   inline void
   Options::c_d(unsigned int d) {
     _c_d.value(d);
@@ -418,6 +450,15 @@ namespace Gecode {
     return _nogoods_limit.value();
   }
 
+  inline void
+  Options::nogoods_max(unsigned int m) {
+    _nogoods_max.value(m);
+  }
+  inline unsigned int
+  Options::nogoods_max(void) const {
+    return _nogoods_max.value();
+  }
+
   inline void
   Options::relax(double d) {
     _relax.value(d);
@@ -439,6 +480,35 @@ namespace Gecode {
   }
 
 
+
+  /*
+   * Memory options
+   *
+   */
+  inline void
+  Options::memory(const MemoryPolicy& mp) {
+    _hcsz_min.value(static_cast<unsigned int>(mp.hcsz_min));
+    _hcsz_max.value(static_cast<unsigned int>(mp.hcsz_max));
+    _hcsz_inc.value(mp.hcsz_inc_ratio);
+    _hcsz_dec.value(mp.hcsz_dec_ratio);
+    _fl_refill.value(mp.fl_refill);
+    _region_size.value(static_cast<unsigned int>(mp.region_area_size));
+    _mem_adapt.value(mp.adaptive);
+  }
+  inline MemoryPolicy
+  Options::memory(void) const {
+    MemoryPolicy mp;
+    mp.hcsz_min = _hcsz_min.value();
+    mp.hcsz_max = _hcsz_max.value();
+    mp.hcsz_inc_ratio = _hcsz_inc.value();
+    mp.hcsz_dec_ratio = _hcsz_dec.value();
+    mp.fl_refill = _fl_refill.value();
+    mp.region_area_size = _region_size.value();
+    mp.adaptive = _mem_adapt.value();
+    return mp;
+  }
+
+
   /*
    * Execution options
    *
@@ -509,6 +579,28 @@ namespace Gecode {
     return _trace.value();
   }
 
+#ifdef GECODE_PROPAGATION_PROFILER
+  inline void
+  Options::profile_file(const char* f) {
+    _profile_file.value(f);
+  }
+
+  inline const char*
+  Options::profile_file(void) const {
+    return _profile_file.value();
+  }
+
+  inline void
+  Options::profile_format(ProfileFormat pf) {
+    _profile_format.value(pf);
+  }
+
+  inline ProfileFormat
+  Options::profile_format(void) const {
+    return static_cast<ProfileFormat>(_profile_format.value());
+  }
+#endif
+
 #ifdef GECODE_HAS_GIST
   forceinline
   Options::_I::_I(void) : _click(heap,1), n_click(0),
@@ -266,7 +266,32 @@ namespace Gecode { namespace Driver {
       std::cerr << "Cannot use restarts and portfolio..." << std::endl;
       exit(EXIT_FAILURE);
     }
-    if (o.restart() != RM_NONE) {
+    if ((o.processes() > 0) &&
+        ((o.restart() != RM_NONE) || (o.assets() > 0))) {
+      std::cerr << "Cannot use distributed search with restarts or portfolio..."
+                << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if ((o.processes() > 0) && DIS<Script,Engine>::worker()) {
+      // Started by a coordinator with the same arguments
+      Search::Options so;
+      so.address = o.address();
+      so.c_d     = o.c_d();
+      so.a_d     = o.a_d();
+      so.clone   = false;
+      try {
+        if (s == NULL)
+          s = new Script(o);
+        (void) DIS<Script,Engine>::work(s,so);
+      } catch (Exception& e) {
+        std::cerr << "Exception: " << e.what() << "." << std::endl;
+        exit(EXIT_FAILURE);
+      }
+      delete s;
+      exit(EXIT_SUCCESS);
+    } else if (o.processes() > 0) {
+      runMeta<Script,Engine,Options,DIS>(o,s);
+    } else if (o.restart() != RM_NONE) {
       runMeta<Script,Engine,Options,RBS>(o,s);
     } else if (o.assets() > 0) {
       runMeta<Script,Engine,Options,PBS>(o,s);
@@ -327,6 +352,10 @@ namespace Gecode { namespace Driver {
           unsigned int n_b = BrancherGroup::all.size(*s);
           Search::Options so;
           so.threads = o.threads();
+          so.eps     = o.eps();
+          so.processes = o.processes();
+          so.address = o.address();
+          so.command = o.argv();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
           so.d_l     = o.d_l();
@@ -336,6 +365,9 @@ namespace Gecode { namespace Driver {
           so.cutoff  = createCutoff(o);
           so.clone   = false;
           so.nogoods_limit = o.nogoods() ? o.nogoods_limit() : 0U;
+          so.nogoods_max = o.nogoods_max();
+          MemoryPolicy mp = o.memory();
+          so.memory  = &mp;
           if (o.interrupt())
             CombinedStop::installCtrlHandler(true);
           {
@@ -423,6 +455,10 @@ namespace Gecode { namespace Driver {
           Search::Options so;
           so.clone   = false;
           so.threads = o.threads();
+          so.eps     = o.eps();
+          so.processes = o.processes();
+          so.address = o.address();
+          so.command = o.argv();
           so.assets  = o.assets();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
@@ -431,6 +467,9 @@ namespace Gecode { namespace Driver {
                                             o.interrupt());
           so.cutoff  = createCutoff(o);
           so.nogoods_limit = o.nogoods() ? o.nogoods_limit() : 0U;
+          so.nogoods_max = o.nogoods_max();
+          MemoryPolicy mp = o.memory();
+          so.memory  = &mp;
           if (o.interrupt())
             CombinedStop::installCtrlHandler(true);
           {
@@ -482,6 +521,10 @@ namespace Gecode { namespace Driver {
               Search::Options so;
               so.clone   = false;
               so.threads = o.threads();
+              so.eps     = o.eps();
+              so.processes = o.processes();
+              so.address = o.address();
+              so.command = o.argv();
               so.assets  = o.assets();
               so.c_d     = o.c_d();
               so.a_d     = o.a_d();
@@ -490,6 +533,9 @@ namespace Gecode { namespace Driver {
                                                 false);
               so.cutoff  = createCutoff(o);
               so.nogoods_limit = o.nogoods() ? o.nogoods_limit() : 0U;
+              so.nogoods_max = o.nogoods_max();
+              MemoryPolicy mp = o.memory();
+              so.memory  = &mp;
               {
                 Meta<Script,Engine> e(s1,so);
                 do {
@@ -521,6 +567,13 @@ namespace Gecode { namespace Driver {
         }
         break;
       }
+#ifdef GECODE_PROPAGATION_PROFILER
+      if (o.profile_file() != NULL) {
+        ofstream prof_file;
+        profiler.print(select_ostream(o.profile_file(), prof_file),
+                       o.profile_format());
+      }
+#endif
     } catch (Exception& e) {
       cerr << "Exception: " << e.what() << "." << endl
            << "Stopping..." << endl;
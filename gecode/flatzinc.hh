@@ -256,6 +256,10 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::StringOption      _mode;       ///< Script mode to run
       Gecode::Driver::BoolOption        _stat;       ///< Emit statistics
       Gecode::Driver::StringValueOption _output;     ///< Output file
+#ifdef GECODE_PROPAGATION_PROFILER
+      Gecode::Driver::StringValueOption _profile_file;   ///< Profile file
+      Gecode::Driver::StringOption      _profile_format; ///< Profile format
+#endif
       //@}
   public:
     /// Constructor
@@ -284,7 +288,13 @@ namespace Gecode { namespace FlatZinc {
       _step("-step","step distance for float optimization",0.0),
       _mode("-mode","how to execute script",Gecode::SM_SOLUTION),
       _stat("-s","emit statistics"),
-      _output("-o","file to send output to") {
+      _output("-o","file to send output to")
+#ifdef GECODE_PROPAGATION_PROFILER
+      , _profile_file("-profile","file to send propagation profile to"),
+      _profile_format("-profile-format","format of propagation profile",
+                      Gecode::PF_CSV)
+#endif
+    {
 
       _mode.add(Gecode::SM_SOLUTION, "solution");
       _mode.add(Gecode::SM_STAT, "stat");
@@ -294,6 +304,10 @@ namespace Gecode { namespace FlatZinc {
       _restart.add(RM_LINEAR,"linear");
       _restart.add(RM_LUBY,"luby");
       _restart.add(RM_GEOMETRIC,"geometric");
+#ifdef GECODE_PROPAGATION_PROFILER
+      _profile_format.add(Gecode::PF_CSV, "csv");
+      _profile_format.add(Gecode::PF_JSON, "json");
+#endif
 
       add(_solutions); add(_threads); add(_c_d); add(_a_d);
       add(_allSolutions);
@@ -306,6 +320,9 @@ namespace Gecode { namespace FlatZinc {
       add(_nogoods); add(_nogoods_limit);
       add(_mode); add(_stat);
       add(_output);
+#ifdef GECODE_PROPAGATION_PROFILER
+      add(_profile_file); add(_profile_format);
+#endif
     }
 
     void parse(int& argc, char* argv[]) {
@@ -336,6 +353,12 @@ namespace Gecode { namespace FlatZinc {
     int seed(void) const { return _seed.value(); }
     double step(void) const { return _step.value(); }
     const char* output(void) const { return _output.value(); }
+#ifdef GECODE_PROPAGATION_PROFILER
+    const char* profile_file(void) const { return _profile_file.value(); }
+    Gecode::ProfileFormat profile_format(void) const {
+      return static_cast<Gecode::ProfileFormat>(_profile_format.value());
+    }
+#endif
     Gecode::ScriptMode mode(void) const {
       return static_cast<Gecode::ScriptMode>(_mode.value());
     }
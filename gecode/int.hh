@@ -190,6 +190,8 @@ namespace Gecode {
       GECODE_INT_EXPORT static IntSetObject* allocate(int m);
       /// Return copy of object
       GECODE_INT_EXPORT SharedHandle::Object* copy(void) const;
+      /// Integer sets are immutable (never copied)
+      virtual bool immutable(void) const;
       /// Check whether \a n is included in the set
       GECODE_INT_EXPORT bool in(int n) const;
       /// Delete object
@@ -950,7 +952,10 @@ namespace Gecode {
     /// Options: basic versus advanced propagation
     IPL_BASIC = 16,    ///< Use basic propagation algorithm
     IPL_ADVANCED = 32, ///< Use advanced propagation algorithm
-    IPL_BASIC_ADVANCED = IPL_BASIC | IPL_ADVANCED ///< Use both
+    IPL_BASIC_ADVANCED = IPL_BASIC | IPL_ADVANCED, ///< Use both
+    /// Options: additional reasoning for scheduling constraints
+    IPL_TTEF = 64,      ///< Use time-table edge-finding
+    IPL_ENERGETIC = 128 ///< Use energetic reasoning
   };
 
   /// Extract value, bounds, or domain propagation from propagation level
@@ -2102,14 +2107,50 @@ namespace Gecode {
       Tuple** last;
       /// Pointer to NULL-pointer
       Tuple* nullpointer;
+      /// Number of tuples with ranges
+      int r_size;
+      /// Excess storage for tuples with ranges
+      int r_excess;
+      /// Tuples with ranges (lower bounds followed by upper bounds)
+      int* r_data;
+      /// Whether a position has a proper range or a wildcard in some tuple
+      bool* r_wide;
+      /// Word of a support bitset (bits for tuples are sorted by position)
+      class SupportWord {
+      public:
+        /// Position of word in bitset of all tuples
+        unsigned int i;
+        /// Bits for the tuples
+        Support::BitSetData b;
+      };
+      /// Number of words for bitset of all tuples
+      unsigned int n_words;
+      /**
+       * \brief First non-empty support word for each position and value
+       *
+       * The bits for the tuples with ranges follow the bits for all
+       * other tuples. A tuple with ranges supports all values in its
+       * range for a position. A wildcard supports all values: after the
+       * entries for all positions and values follows an entry for the
+       * wildcards at each position (supporting the values outside the
+       * domain-values).
+       */
+      unsigned int* s_fst;
+      /// Non-empty support words
+      SupportWord* s_words;
 
       /// Add Tuple. Assumes that arity matches.
       template<class T>
       void add(T t);
+      /// Add tuple with ranges from \a l to \a u. Assumes that arity matches.
+      template<class T>
+      void add(T l, T u);
       /// Finalize datastructure (disallows additions of more Tuples)
       GECODE_INT_EXPORT void finalize(void);
       /// Resize data cache
       GECODE_INT_EXPORT void resize(void);
+      /// Resize data cache for tuples with ranges
+      GECODE_INT_EXPORT void r_resize(void);
       /// Is datastructure finalized
       bool finalized(void) const;
       /// Initialize as empty tuple set
@@ -2118,6 +2159,8 @@ namespace Gecode {
       GECODE_INT_EXPORT virtual ~TupleSetI(void);
       /// Create a copy
       GECODE_INT_EXPORT virtual SharedHandle::Object* copy(void) const;
+      /// Finalized tuple sets are immutable (never copied)
+      virtual bool immutable(void) const;
     };
 
     /// Get implementation
@@ -2128,18 +2171,44 @@ namespace Gecode {
     /// Initialize by TupleSet \a d (tuple set is shared)
     TupleSet(const TupleSet& d);
 
-    /// Add tuple to tuple set
+    /**
+     * \brief Wildcard entry for a tuple
+     *
+     * A wildcard matches all values of the variable at its position,
+     * including values outside of the domain-values of the tuple set.
+     */
+    static const int any = Int::Limits::min - 1;
+
+    /**
+     * \brief Add tuple to tuple set
+     *
+     * Entries of \a tuple can be TupleSet::any (wildcards).
+     */
     void add(const IntArgs& tuple);
+    /**
+     * \brief Add tuple with ranges to tuple set
+     *
+     * The tuple matches all tuples with values from \a l[i] to
+     * \a u[i] at position \a i. Entries of \a l can be TupleSet::any
+     * (wildcards), the corresponding entries of \a u are ignored.
+     */
+    void add(const IntArgs& l, const IntArgs& u);
     /// Finalize tuple set
     void finalize(void);
     /// Is tuple set finalized
     bool finalized(void) const;
     /// Arity of tuple set
     int arity(void) const;
-    /// Number of tuples
+    /// Number of tuples (without ranges)
     int tuples(void) const;
     /// Get tuple i
     Tuple operator [](int i) const;
+    /// Number of tuples with ranges (including wildcards)
+    int ranges(void) const;
+    /// Get lower bounds (or TupleSet::any) of tuple with ranges \a i
+    Tuple lower(int i) const;
+    /// Get upper bounds (or TupleSet::any) of tuple with ranges \a i
+    Tuple upper(int i) const;
     /// Minimum domain element
     int min(void) const;
     /// Maximum domain element
@@ -2151,7 +2220,14 @@ namespace Gecode {
    * \li Supports implementations optimized for speed (with propagation
    *     level \a ipl or-ed with \a IPL_SPEED, default) and memory
    *     consumption (with propagation level \a ipl or-ed with
-   *     \a IPL_MEMORY).
+   *     \a IPL_MEMORY). The implementation optimized for speed uses
+   *     compact tables (bitsets of valid tuples), the incremental
+   *     algorithm based on explicit supports can be selected with
+   *     \a ipl or-ed with \a IPL_BASIC. If \a t contains tuples with
+   *     ranges or wildcards, compact tables are always used.
+   * \li Wildcards in \a t match all values of the corresponding
+   *     variables in \a x, including values that are not between the
+   *     minimum and maximum of \a t.
    * \li Supports domain consistency (\a ipl = IPL_DOM, default) only.
    * \li Throws an exception of type Int::ArgumentSizeMismatch, if
    *     \a x and \a t are of different size.
@@ -2162,9 +2238,9 @@ namespace Gecode {
    * have similar bounds, lots of memory will be wasted (memory
    * consumption is in \f$
    * O\left(|x|\cdot\min_i(\underline{x_i})\cdot\max_i(\overline{x_i})\right)\f$
-   * for the basic algorithm (\a epk = \a EPK_MEMORY) and additionally \f$
+   * for the basic algorithm (\a ipl = \a IPL_MEMORY) and additionally \f$
    * O\left(|x|^2\cdot\min_i(\underline{x_i})\cdot\max_i(\overline{x_i})\right)\f$
-   * for the incremental algorithm (\a epk = \a EPK_SPEED).
+   * for the incremental algorithm (\a ipl = \a IPL_BASIC).
    */
   GECODE_INT_EXPORT void
   extensional(Home home, const IntVarArgs& x, const TupleSet& t,
@@ -2175,7 +2251,14 @@ namespace Gecode {
    * \li Supports implementations optimized for speed (with propagation
    *     level \a ipl or-ed with \a IPL_SPEED, default) and memory
    *     consumption (with propagation level \a ipl or-ed with
-   *     \a IPL_MEMORY).
+   *     \a IPL_MEMORY). The implementation optimized for speed uses
+   *     compact tables (bitsets of valid tuples), the incremental
+   *     algorithm based on explicit supports can be selected with
+   *     \a ipl or-ed with \a IPL_BASIC. If \a t contains tuples with
+   *     ranges or wildcards, compact tables are always used.
+   * \li Wildcards in \a t match all values of the corresponding
+   *     variables in \a x, including values that are not between the
+   *     minimum and maximum of \a t.
    * \li Supports domain consistency (\a ipl = IPL_DOM, default) only.
    * \li Throws an exception of type Int::ArgumentSizeMismatch, if
    *     \a x and \a t are of different size.
@@ -2651,6 +2734,10 @@ namespace Gecode {
    * Propagate that no two rectangles as described by the coordinates
    * \a x, and \a y, widths \a w, and heights \a h overlap.
    *
+   * Supports pairwise propagation (\a ipl = IPL_DEF) and propagation
+   * by sweeping over forbidden regions (\a ipl = IPL_BND) which is
+   * more efficient for many rectangles.
+   *
    * Throws the following exceptions:
    *  - Of type Int::ArgumentSizeMismatch if \a x, \a w, \a y, or \a h
    *    are not of the same size.
@@ -2669,6 +2756,10 @@ namespace Gecode {
    * \a x, and \a y, widths \a w, and heights \a h overlap. The rectangles
    * can be optional, as described by the Boolean variables \a o.
    *
+   * Supports pairwise propagation (\a ipl = IPL_DEF) and propagation
+   * by sweeping over forbidden regions (\a ipl = IPL_BND) which is
+   * more efficient for many rectangles.
+   *
    * Throws the following exceptions:
    *  - Of type Int::ArgumentSizeMismatch if \a x, \a w, \a y, \a h, or \a o
    *    are not of the same size.
@@ -2692,6 +2783,9 @@ namespace Gecode {
    * not propagated (for \f$0\leq i<|x0|\f$). That is, additional constraints
    * must be posted to enforce that relation.
    *
+   * Propagation by sweeping (\a ipl = IPL_BND) is only used if
+   * all widths and heights are assigned when posting.
+   *
    * Throws the following exceptions:
    *  - Of type Int::ArgumentSizeMismatch if \a x0, \a x1, \a w,
    *    \a y0, \a y1, or \a h are not of the same size.
@@ -2714,6 +2808,9 @@ namespace Gecode {
    * not propagated (for \f$0\leq i<|x0|\f$). That is, additional constraints
    * must be posted to enforce that relation.
    *
+   * Propagation by sweeping (\a ipl = IPL_BND) is only used if
+   * all widths and heights are assigned when posting.
+   *
    * Throws the following exceptions:
    *  - Of type Int::ArgumentSizeMismatch if \a x0, \a x1, \a w,
    *    \a y0, \a y1, or \a h are not of the same size.
@@ -3085,6 +3182,13 @@ namespace Gecode {
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
    *    performed.
+   *  - If \a IPL_TTEF is set, the propagator performs overload checking,
+   *    time-tabling, and time-table edge finding (\a IPL_BASIC and
+   *    \a IPL_ADVANCED are ignored).
+   *  - If \a IPL_ENERGETIC is set, the propagator performs overload
+   *    checking, time-tabling, and energetic reasoning (\a IPL_TTEF,
+   *    \a IPL_BASIC, and \a IPL_ADVANCED are ignored). Note that
+   *    energetic reasoning takes cubic time in the number of tasks.
    *
    * The propagator uses algorithms taken from:
    *
@@ -3144,6 +3248,13 @@ namespace Gecode {
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
    *    performed.
+   *  - If \a IPL_TTEF is set, the propagator performs overload checking,
+   *    time-tabling, and time-table edge finding (\a IPL_BASIC and
+   *    \a IPL_ADVANCED are ignored).
+   *  - If \a IPL_ENERGETIC is set, the propagator performs overload
+   *    checking, time-tabling, and energetic reasoning (\a IPL_TTEF,
+   *    \a IPL_BASIC, and \a IPL_ADVANCED are ignored). Note that
+   *    energetic reasoning takes cubic time in the number of tasks.
    *
    * The propagator uses algorithms taken from:
    *
@@ -3189,6 +3300,13 @@ namespace Gecode {
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
    *    performed.
+   *  - If \a IPL_TTEF is set, the propagator performs overload checking,
+   *    time-tabling, and time-table edge finding (\a IPL_BASIC and
+   *    \a IPL_ADVANCED are ignored).
+   *  - If \a IPL_ENERGETIC is set, the propagator performs overload
+   *    checking, time-tabling, and energetic reasoning (\a IPL_TTEF,
+   *    \a IPL_BASIC, and \a IPL_ADVANCED are ignored). Note that
+   *    energetic reasoning takes cubic time in the number of tasks.
    *
    * The propagator uses algorithms taken from:
    *
@@ -3234,6 +3352,13 @@ namespace Gecode {
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
    *    performed.
+   *  - If \a IPL_TTEF is set, the propagator performs overload checking,
+   *    time-tabling, and time-table edge finding (\a IPL_BASIC and
+   *    \a IPL_ADVANCED are ignored).
+   *  - If \a IPL_ENERGETIC is set, the propagator performs overload
+   *    checking, time-tabling, and energetic reasoning (\a IPL_TTEF,
+   *    \a IPL_BASIC, and \a IPL_ADVANCED are ignored). Note that
+   *    energetic reasoning takes cubic time in the number of tasks.
    *
    * The propagator uses algorithms taken from:
    *
@@ -3281,6 +3406,13 @@ namespace Gecode {
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
    *    performed.
+   *  - If \a IPL_TTEF is set, the propagator performs overload checking,
+   *    time-tabling, and time-table edge finding (\a IPL_BASIC and
+   *    \a IPL_ADVANCED are ignored).
+   *  - If \a IPL_ENERGETIC is set, the propagator performs overload
+   *    checking, time-tabling, and energetic reasoning (\a IPL_TTEF,
+   *    \a IPL_BASIC, and \a IPL_ADVANCED are ignored). Note that
+   *    energetic reasoning takes cubic time in the number of tasks.
    *
    * The propagator uses algorithms taken from:
    *
@@ -3330,6 +3462,13 @@ namespace Gecode {
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
    *    performed.
+   *  - If \a IPL_TTEF is set, the propagator performs overload checking,
+   *    time-tabling, and time-table edge finding (\a IPL_BASIC and
+   *    \a IPL_ADVANCED are ignored).
+   *  - If \a IPL_ENERGETIC is set, the propagator performs overload
+   *    checking, time-tabling, and energetic reasoning (\a IPL_TTEF,
+   *    \a IPL_BASIC, and \a IPL_ADVANCED are ignored). Note that
+   *    energetic reasoning takes cubic time in the number of tasks.
    *
    * The propagator uses algorithms taken from:
    *
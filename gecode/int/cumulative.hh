@@ -690,12 +690,20 @@ namespace Gecode { namespace Int { namespace Cumulative {
   /// Perform time-tabling propagation
   template<class Task, class Cap>
   ExecStatus timetabling(Space& home, Propagator& p, Cap c,
-                         TaskArray<Task>& t);
+                         TaskArray<Task>& t, ResourceProfile& rp);
 
   /// Propagate by edge-finding
   template<class Task>
   ExecStatus edgefinding(Space& home, int c, TaskArray<Task>& t);
 
+  /// Propagate by time-table edge-finding
+  template<class ManTask>
+  ExecStatus ttef(Space& home, int c, TaskArray<ManTask>& t);
+
+  /// Propagate by energetic reasoning
+  template<class ManTask>
+  ExecStatus energetic(Space& home, int c, TaskArray<ManTask>& t);
+
   /**
    * \brief Scheduling propagator for cumulative resource with mandatory tasks
    *
@@ -708,6 +716,10 @@ namespace Gecode { namespace Int { namespace Cumulative {
     using TaskProp<ManTask,PL>::t;
     /// Resource capacity
     Cap c;
+    /// Profile cached for time-tabling
+    ResourceProfile rp;
+    /// Signature of tasks for last time-table edge-finding or energetic run
+    ResourceProfile::Signature es;
     /// Constructor for creation
     ManProp(Home home, Cap c, TaskArray<ManTask>& t);
     /// Constructor for cloning \a p
@@ -735,6 +747,10 @@ namespace Gecode { namespace Int { namespace Cumulative {
     using TaskProp<OptTask,PL>::t;
     /// Resource capacity
     Cap c;
+    /// Profile cached for time-tabling
+    ResourceProfile rp;
+    /// Signature of tasks for last time-table edge-finding or energetic run
+    ResourceProfile::Signature es;
     /// Constructor for creation
     OptProp(Home home, Cap c, TaskArray<OptTask>& t);
     /// Constructor for cloning \a p
@@ -766,6 +782,8 @@ namespace Gecode { namespace Int { namespace Cumulative {
 #include <gecode/int/cumulative/subsumption.hpp>
 #include <gecode/int/cumulative/overload.hpp>
 #include <gecode/int/cumulative/edge-finding.hpp>
+#include <gecode/int/cumulative/ttef.hpp>
+#include <gecode/int/cumulative/energetic.hpp>
 #include <gecode/int/cumulative/man-prop.hpp>
 #include <gecode/int/cumulative/opt-prop.hpp>
 #include <gecode/int/cumulative/post.hpp>
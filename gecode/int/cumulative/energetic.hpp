@@ -0,0 +1,133 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Cumulative {
+
+  /// Return minimal energy task \a t requires in window from \a a to \a b
+  template<class TaskView>
+  forceinline long long int
+  minenergy(const TaskView& t, int a, int b) {
+    long long int o =
+      std::min(std::min(static_cast<long long int>(b) - a,
+                        static_cast<long long int>(t.pmin())),
+               std::min(static_cast<long long int>(t.ect()) - a,
+                        static_cast<long long int>(b) - t.lst()));
+    return (o > 0) ? t.c() * o : 0;
+  }
+
+  template<class TaskView>
+  forceinline ExecStatus
+  energetic(Space& home, int c, TaskViewArray<TaskView>& t) {
+    int n = t.size();
+
+    Region r(home);
+
+    // Tasks sorted by earliest start and latest completion times
+    int* est = r.alloc<int>(n);
+    sort<TaskView,STO_EST,true>(est,t);
+    int* lct = r.alloc<int>(n);
+    sort<TaskView,STO_LCT,true>(lct,t);
+
+    // Minimal energy of tasks in the current window
+    long long int* me = r.alloc<long long int>(n);
+
+    // New earliest start times
+    int* u = r.alloc<int>(n);
+    for (int i=n; i--; )
+      u[i] = t[i].est();
+
+    for (int k=0; k<n; k++) {
+      // Left end of window
+      int a = t[est[k]].est();
+      if ((k > 0) && (t[est[k-1]].est() == a))
+        continue;
+      for (int j=n; j--; ) {
+        // Right end of window
+        int b = t[lct[j]].lct();
+        if (b <= a)
+          break;
+        if ((j+1 < n) && (t[lct[j+1]].lct() == b))
+          continue;
+        long long int e = 0;
+        for (int i=n; i--; ) {
+          me[i] = minenergy(t[i],a,b);
+          e += me[i];
+        }
+        long long int w =
+          static_cast<long long int>(c) * (static_cast<long long int>(b) - a);
+        if (e > w)
+          return ES_FAILED;
+        for (int i=n; i--; )
+          if (t[i].c() > 0) {
+            // Energy in the window when starting at earliest start time
+            long long int o =
+              std::min(static_cast<long long int>(b),
+                       static_cast<long long int>(t[i].est())+t[i].pmin())
+              - std::max(a,t[i].est());
+            // Energy available for task i in the window
+            long long int av = w - e + me[i];
+            if (t[i].c() * o > av) {
+              long long int s = b - av / t[i].c();
+              if (s > u[i])
+                u[i] = static_cast<int>(s);
+            }
+          }
+      }
+    }
+
+    for (int i=n; i--; )
+      if (u[i] > t[i].est())
+        GECODE_ME_CHECK(t[i].est(home,u[i]));
+
+    return ES_OK;
+  }
+
+  template<class ManTask>
+  ExecStatus
+  energetic(Space& home, int c, TaskArray<ManTask>& t) {
+    TaskViewArray<typename TaskTraits<ManTask>::TaskViewFwd> f(t);
+    GECODE_ES_CHECK(energetic(home,c,f));
+    TaskViewArray<typename TaskTraits<ManTask>::TaskViewBwd> b(t);
+    GECODE_ES_CHECK(energetic(home,c,b));
+    return ES_OK;
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -44,14 +44,16 @@ namespace Gecode { namespace Int { namespace Cumulative {
   ManProp<ManTask,Cap,PL>::ManProp(Home home, Cap c0, TaskArray<ManTask>& t)
     : TaskProp<ManTask,PL>(home,t), c(c0) {
     c.subscribe(home,*this,PC_INT_BND);
+    es.init(-1,0);
   }
 
   template<class ManTask, class Cap, class PL>
   forceinline
   ManProp<ManTask,Cap,PL>::ManProp(Space& home, bool shared,
                                    ManProp<ManTask,Cap,PL>& p)
-    : TaskProp<ManTask,PL>(home,shared,p) {
+    : TaskProp<ManTask,PL>(home,shared,p), es(p.es) {
     c.update(home,shared,p.c);
+    rp.update(home,p.rp);
   }
 
   template<class ManTask, class Cap, class PL>
@@ -104,7 +106,22 @@ namespace Gecode { namespace Int { namespace Cumulative {
       GECODE_ES_CHECK(edgefinding(home,c.max(),t));
 
     if (PL::basic)
-      GECODE_ES_CHECK(timetabling(home,*this,c,t));
+      GECODE_ES_CHECK(timetabling(home,*this,c,t,rp));
+
+    if (PL::ttef || PL::energetic) {
+      // Only propagate if compulsory parts or time windows have changed
+      ResourceProfile::Signature s;
+      s.init(t.size(),c.max());
+      for (int i=t.size(); i--; )
+        s.add(t[i],t[i].c());
+      if (!s.equal(es)) {
+        es = s;
+        if (PL::ttef)
+          GECODE_ES_CHECK(ttef(home,c.max(),t));
+        else
+          GECODE_ES_CHECK(energetic(home,c.max(),t));
+      }
+    }
 
     if (Cap::varderived() && c.assigned() && (c.val() == 1)) {
       // Check that tasks do not overload resource
@@ -46,14 +46,16 @@ namespace Gecode { namespace Int { namespace Cumulative {
   OptProp<OptTask,Cap,PL>::OptProp(Home home, Cap c0, TaskArray<OptTask>& t)
     : TaskProp<OptTask,PL>(home,t), c(c0) {
     c.subscribe(home,*this,PC_INT_BND);
+    es.init(-1,0);
   }
 
   template<class OptTask, class Cap, class PL>
   forceinline
   OptProp<OptTask,Cap,PL>::OptProp(Space& home, bool shared,
                                    OptProp<OptTask,Cap,PL>& p)
-    : TaskProp<OptTask,PL>(home,shared,p) {
+    : TaskProp<OptTask,PL>(home,shared,p), es(p.es) {
     c.update(home,shared,p.c);
+    rp.update(home,p.rp);
   }
 
   template<class OptTask, class Cap, class PL>
@@ -128,9 +130,21 @@ namespace Gecode { namespace Int { namespace Cumulative {
       GECODE_ES_CHECK(overload(home,c.max(),t));
 
     if (PL::basic)
-      GECODE_ES_CHECK(timetabling(home,*this,c,t));
+      GECODE_ES_CHECK(timetabling(home,*this,c,t,rp));
 
-    if (PL::advanced) {
+    bool energy = false;
+    if (PL::ttef || PL::energetic) {
+      // Only propagate if compulsory parts or time windows have changed
+      ResourceProfile::Signature s;
+      s.init(t.size(),c.max());
+      for (int i=t.size(); i--; )
+        s.add(t[i],t[i].c());
+      if (!s.equal(es)) {
+        es = s; energy = true;
+      }
+    }
+
+    if (PL::advanced || energy) {
       // Partition into mandatory and optional activities
       int n = t.size();
       int i=0, j=n-1;
@@ -144,7 +158,12 @@ namespace Gecode { namespace Int { namespace Cumulative {
       if (i > 1) {
         // Truncate array to only contain mandatory tasks
         t.size(i);
-        GECODE_ES_CHECK(edgefinding(home,c.max(),t));
+        if (PL::advanced)
+          GECODE_ES_CHECK(edgefinding(home,c.max(),t));
+        if (energy && PL::ttef)
+          GECODE_ES_CHECK(ttef(home,c.max(),t));
+        if (energy && PL::energetic)
+          GECODE_ES_CHECK(energetic(home,c.max(),t));
         // Restore to also include optional tasks
         t.size(n);
       }
@@ -40,6 +40,10 @@ namespace Gecode { namespace Int { namespace Cumulative {
   template<class ManTask, class Cap>
   forceinline ExecStatus
   manpost(Home home, Cap c, TaskArray<ManTask>& t, IntPropLevel ipl) {
+    if (ipl & IPL_ENERGETIC)
+      return ManProp<ManTask,Cap,PLBE>::post(home,c,t);
+    if (ipl & IPL_TTEF)
+      return ManProp<ManTask,Cap,PLBT>::post(home,c,t);
     switch (ba(ipl)) {
     case IPL_BASIC: default:
       return ManProp<ManTask,Cap,PLB>::post(home,c,t);
@@ -55,6 +59,10 @@ namespace Gecode { namespace Int { namespace Cumulative {
   template<class OptTask, class Cap>
   forceinline ExecStatus
   optpost(Home home, Cap c, TaskArray<OptTask>& t, IntPropLevel ipl) {
+    if (ipl & IPL_ENERGETIC)
+      return OptProp<OptTask,Cap,PLBE>::post(home,c,t);
+    if (ipl & IPL_TTEF)
+      return OptProp<OptTask,Cap,PLBT>::post(home,c,t);
     switch (ba(ipl)) {
     case IPL_BASIC: default:
       return OptProp<OptTask,Cap,PLB>::post(home,c,t);
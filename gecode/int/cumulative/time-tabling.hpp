@@ -56,11 +56,41 @@ namespace Gecode { namespace Int { namespace Cumulative {
   // Basic propagation (timetabling)
   template<class Task, class Cap>
   forceinline ExecStatus
-  timetabling(Space& home, Propagator& p, Cap c, TaskArray<Task>& t) {
+  timetabling(Space& home, Propagator& p, Cap c, TaskArray<Task>& t,
+              ResourceProfile& rp) {
     int ccur = c.max();
     int cmax = ccur;
     int cmin = ccur;
 
+    ResourceProfile::Signature s;
+    s.init(t.size(),ccur);
+    for (int i=t.size(); i--; )
+      s.add(t[i],t[i].c());
+
+    if (rp.unchanged(s)) {
+      // Profile is still valid, only check the tasks' time windows
+      bool assigned = true;
+      if (rp.same(s)) {
+        for (int i=t.size(); i--; )
+          if (!t[i].assigned()) {
+            assigned = false; break;
+          }
+      } else {
+        rp.window(s);
+        for (int i=t.size(); i--; )
+          if (!t[i].assigned()) {
+            assigned = false;
+            if (t[i].mandatory())
+              GECODE_ES_CHECK(rp.check(home,t[i],t[i].c()));
+          }
+      }
+      if (assigned)
+        return home.ES_SUBSUMED(p);
+      return ES_NOFIX;
+    }
+
+    rp.init(home,s,4*t.size()+1);
+
     // Sort tasks by decreasing capacity
     TaskByDecCap<Task> tbdc;
     Support::quicksort(&t[0], t.size(), tbdc);
@@ -113,6 +143,9 @@ namespace Gecode { namespace Int { namespace Cumulative {
             GECODE_ME_CHECK(t[e->idx()].excluded(home));
           }
 
+        // Record free capacity until next time
+        rp.segment(time,ccur);
+
         // Exploit that tasks are sorted according to capacity
         for (Iter::Values::BitSet<Support::BitSet<Region> > j(tasks);
              j() && (t[j.val()].c() > ccur); ++j)
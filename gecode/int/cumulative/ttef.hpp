@@ -0,0 +1,154 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Cumulative {
+
+  /// Return energy of the compulsory parts of tasks \a t before time \a x
+  template<class TaskView>
+  forceinline long long int
+  ttenergy(const TaskViewArray<TaskView>& t, int x) {
+    long long int e = 0;
+    for (int i=t.size(); i--; )
+      if ((t[i].lst() < t[i].ect()) && (t[i].lst() < x))
+        e += static_cast<long long int>(t[i].c()) *
+          (static_cast<long long int>(std::min(x,t[i].ect())) - t[i].lst());
+    return e;
+  }
+
+  template<class TaskView>
+  forceinline ExecStatus
+  ttef(Space& home, int c, TaskViewArray<TaskView>& t) {
+    int n = t.size();
+
+    Region r(home);
+
+    // Tasks sorted by earliest start and latest completion times
+    int* est = r.alloc<int>(n);
+    sort<TaskView,STO_EST,true>(est,t);
+    int* lct = r.alloc<int>(n);
+    sort<TaskView,STO_LCT,true>(lct,t);
+
+    // Energy of the profile before earliest start and latest completion
+    long long int* ee = r.alloc<long long int>(n);
+    long long int* le = r.alloc<long long int>(n);
+    for (int i=n; i--; ) {
+      ee[i] = ttenergy(t,t[i].est());
+      le[i] = ttenergy(t,t[i].lct());
+    }
+
+    // New earliest start times
+    int* u = r.alloc<int>(n);
+    for (int i=n; i--; )
+      u[i] = t[i].est();
+
+    for (int j=n; j--; ) {
+      // Right end of window
+      int b = t[lct[j]].lct();
+      if ((j+1 < n) && (t[lct[j+1]].lct() == b))
+        continue;
+      // Free energy (not in the profile) of tasks inside the window
+      long long int fe = 0;
+      /*
+       * Task ending after the window with the most free energy in the
+       * window when starting at its earliest start time
+       */
+      int m = -1;
+      long long int me = 0;
+      for (int k=n; k--; ) {
+        int i = est[k];
+        // Left end of window
+        int a = t[i].est();
+        if (a >= b)
+          continue;
+        long long int cp =
+          std::max(0LL,static_cast<long long int>(t[i].ect())-t[i].lst());
+        if (t[i].lct() <= b) {
+          fe += static_cast<long long int>(t[i].c()) *
+            std::max(0LL,t[i].pmin()-cp);
+        } else {
+          long long int o =
+            std::min(static_cast<long long int>(b),
+                     static_cast<long long int>(a)+t[i].pmin()) - a
+            - std::max(0LL,static_cast<long long int>(std::min(b,t[i].ect()))
+                       - t[i].lst());
+          long long int e = static_cast<long long int>(t[i].c()) * o;
+          if (e > me) {
+            m = i; me = e;
+          }
+        }
+        if ((k > 0) && (t[est[k-1]].est() == a))
+          continue;
+        // Energy still available in the window
+        long long int av =
+          static_cast<long long int>(c) * (static_cast<long long int>(b) - a)
+          - (le[lct[j]] - ee[i]) - fe;
+        if (av < 0)
+          return ES_FAILED;
+        if (me > av) {
+          // Task m cannot start before its free part fits into the window
+          long long int cpm =
+            std::max(0LL,static_cast<long long int>(std::min(b,t[m].ect()))
+                     - t[m].lst());
+          long long int s = b - cpm - av / t[m].c();
+          if (s > u[m])
+            u[m] = static_cast<int>(s);
+        }
+      }
+    }
+
+    for (int i=n; i--; )
+      if (u[i] > t[i].est())
+        GECODE_ME_CHECK(t[i].est(home,u[i]));
+
+    return ES_OK;
+  }
+
+  template<class ManTask>
+  ExecStatus
+  ttef(Space& home, int c, TaskArray<ManTask>& t) {
+    TaskViewArray<typename TaskTraits<ManTask>::TaskViewFwd> f(t);
+    GECODE_ES_CHECK(ttef(home,c,f));
+    TaskViewArray<typename TaskTraits<ManTask>::TaskViewBwd> b(t);
+    GECODE_ES_CHECK(ttef(home,c,b));
+    return ES_OK;
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -183,7 +183,16 @@ namespace Gecode { namespace Int { namespace Distinct {
   ExecStatus prop_bnd(Space& home, ViewArray<View>& x);
 
 
-  /// View-value graph for propagation
+  /**
+   * \brief View-value graph for propagation
+   *
+   * The graph is kept between propagator executions: only view nodes
+   * that have lost their matching edge are matched again and only
+   * strongly connected components that are affected by changes to
+   * edges or to the matching are computed again. Components that
+   * are not reachable from a free value and are not affected remain
+   * strongly connected and do not have any edges to other components.
+   */
   template<class View>
   class Graph : public ViewValGraph::Graph<View> {
   public:
@@ -194,10 +203,34 @@ namespace Gecode { namespace Int { namespace Distinct {
     using ViewValGraph::Graph<View>::count;
     using ViewValGraph::Graph<View>::scc;
     using ViewValGraph::Graph<View>::match;
+  protected:
+    /// Matching edge of a view to be tried first during initialization
+    class Hint {
+    public:
+      /// Variable implementation of the view
+      typename View::VarImpType* x;
+      /// Value of the matching edge
+      int v;
+      /// Order hints by variable implementation
+      bool operator <(const Hint& h) const;
+    };
+    /// Hints for initialization
+    Hint* hint;
+    /// Number of hints
+    int n_hint;
+  public:
     /// Construct graph as not yet initialized
     Graph(void);
     /// Initialize graph
     ExecStatus init(Space& home, ViewArray<View>& x);
+    /**
+     * \brief Use matching of \a g as hints for initialization
+     *
+     * The views \a x must be the copies of the views \a y during
+     * cloning.
+     */
+    void hints(Space& home, Graph<View>& g,
+               ViewArray<View>& x, ViewArray<View>& y);
     /// Mark edges in graph, return true if pruning is at all possible
     bool mark(Space& home);
     /// Prune unmarked edges, \a assigned is true if a view got assigned
@@ -228,6 +261,15 @@ namespace Gecode { namespace Int { namespace Distinct {
     bool available(void);
     /// Initialize view-value graph for views \a x
     ExecStatus init(Space& home, ViewArray<View>& x);
+    /**
+     * \brief Update during cloning from controller \a d
+     *
+     * The views \a x must be the copies of the views \a y. The
+     * matching of \a d is used when the view-value graph is
+     * initialized.
+     */
+    void update(Space& home, DomCtrl<View>& d,
+                ViewArray<View>& x, ViewArray<View>& y);
     /// Synchronize available view-value graph
     ExecStatus sync(Space& home);
     /// Perform propagation, \a assigned is true if a view gets assigned
@@ -60,6 +60,14 @@ namespace Gecode { namespace Int { namespace Distinct {
     return g.init(home,x);
   }
 
+  template<class View>
+  forceinline void
+  DomCtrl<View>::update(Space& home, DomCtrl<View>& d,
+                        ViewArray<View>& x, ViewArray<View>& y) {
+    if (d.available())
+      g.hints(home,d.g,x,y);
+  }
+
   template<class View>
   ExecStatus
   DomCtrl<View>::sync(Space& home) {
@@ -62,7 +62,9 @@ namespace Gecode { namespace Int { namespace Distinct {
   template<class View>
   forceinline
   Dom<View>::Dom(Space& home, bool share, Dom<View>& p)
-    : NaryPropagator<View,PC_INT_DOM>(home,share,p) {}
+    : NaryPropagator<View,PC_INT_DOM>(home,share,p) {
+    dc.update(home,p.dc,x,p.x);
+  }
 
   template<class View>
   PropCost
@@ -39,9 +39,76 @@
 
 namespace Gecode { namespace Int { namespace Distinct {
 
+  template<class View>
+  forceinline bool
+  Graph<View>::Hint::operator <(const Hint& h) const {
+    return x < h.x;
+  }
+
   template<class View>
   forceinline
-  Graph<View>::Graph(void) {}
+  Graph<View>::Graph(void) : hint(NULL), n_hint(0) {}
+
+  /// Sort view indices by variable implementation
+  template<class View>
+  class ViewIdxLess {
+  protected:
+    /// The views
+    const ViewArray<View>& y;
+  public:
+    /// Initialize with views \a y0
+    ViewIdxLess(const ViewArray<View>& y0) : y(y0) {}
+    /// Test whether view \a i comes before view \a j
+    bool operator ()(int i, int j) {
+      return before(y[i],y[j]);
+    }
+  };
+
+  template<class View>
+  void
+  Graph<View>::hints(Space& home, Graph<View>& g,
+                     ViewArray<View>& x, ViewArray<View>& y) {
+    using namespace ViewValGraph;
+    if ((g.n_view == 0) || (y.size() == 0))
+      return;
+    // Original views sorted by variable implementation
+    int* s = heap.alloc<int>(y.size());
+    for (int i=y.size(); i--; )
+      s[i]=i;
+    ViewIdxLess<View> vil(y);
+    Support::quicksort<int,ViewIdxLess<View> >(s,y.size(),vil);
+
+    Hint* h = heap.alloc<Hint>(g.n_view);
+    int n = 0;
+    for (int i=g.n_view; i--; ) {
+      ViewNode<View>* v = g.view[i];
+      if (!v->matched())
+        continue;
+      // Find original view by binary search
+      int lo=0, hi=y.size()-1;
+      while (lo < hi) {
+        int m = lo + (hi-lo) / 2;
+        if (before(y[s[m]],v->view()))
+          lo = m+1;
+        else
+          hi = m;
+      }
+      if (same(y[s[lo]],v->view())) {
+        h[n].x = x[s[lo]].varimp();
+        h[n].v = v->edge_fst()->val(v)->val();
+        n++;
+      }
+    }
+    heap.free<int>(s,y.size());
+    if (n > 0) {
+      Support::quicksort<Hint>(h,n);
+      hint = home.alloc<Hint>(n);
+      for (int i=n; i--; )
+        hint[i] = h[i];
+      n_hint = n;
+    }
+    heap.free<Hint>(h,g.n_view);
+  }
 
   template<class View>
   forceinline ExecStatus
@@ -104,9 +171,37 @@ namespace Gecode { namespace Int { namespace Distinct {
     if (n_val < n_view)
       return ES_FAILED;
 
+    if (n_hint > 0) {
+      // Start from the matching of the graph this graph is a copy of
+      for (int i = n_view; i--; ) {
+        typename View::VarImpType* vx = view[i]->view().varimp();
+        int lo=0, hi=n_hint-1;
+        while (lo < hi) {
+          int m = lo + (hi-lo) / 2;
+          if (hint[m].x < vx)
+            lo = m+1;
+          else
+            hi = m;
+        }
+        if (hint[lo].x != vx)
+          continue;
+        for (Edge<View>* e = view[i]->val_edges(); e != NULL;
+             e = e->next_edge())
+          if (e->val(view[i])->val() >= hint[lo].v) {
+            if ((e->val(view[i])->val() == hint[lo].v) &&
+                !e->val(view[i])->matching()) {
+              e->revert(view[i]); e->val(view[i])->matching(e);
+            }
+            break;
+          }
+      }
+      home.free<Hint>(hint,n_hint);
+      hint = NULL; n_hint = 0;
+    }
+
     typename ViewValGraph::Graph<View>::ViewNodeStack m(r,n_view);
     for (int i = n_view; i--; )
-      if (!match(m,view[i]))
+      if (!view[i]->matched() && !match(m,view[i]))
         return ES_FAILED;
     return ES_OK;
   }
@@ -118,15 +213,20 @@ namespace Gecode { namespace Int { namespace Distinct {
     Region r(home);
     // Stack for view nodes to be rematched
     typename ViewValGraph::Graph<View>::ViewNodeStack re(r,n_view);
+    // Components affected by changes
+    unsigned int* ac = r.alloc<unsigned int>(2*n_view);
+    int n_ac = 0;
     // Synchronize nodes
     for (int i = n_view; i--; ) {
       ViewNode<View>* x = view[i];
       if (x->view().assigned()) {
+        ac[n_ac++] = x->comp;
         x->edge_fst()->val(x)->matching(NULL);
         for (Edge<View>* e = x->val_edges(); e != NULL; e = e->next_edge())
           e->unlink();
         view[i] = view[--n_view];
       } else if (x->changed()) {
+        ac[n_ac++] = x->comp;
         ViewRanges<View> rx(x->view());
         Edge<View>*  m = x->edge_fst();      // Matching edge
         Edge<View>** p = x->val_edges_ref();
@@ -165,10 +265,37 @@ namespace Gecode { namespace Int { namespace Distinct {
       }
     }
 
-    typename ViewValGraph::Graph<View>::ViewNodeStack m(r,n_view);
-    while (!re.empty())
-      if (!match(m,re.pop()))
-        return false;
+    if (!re.empty()) {
+      // Remember matching to find the views on augmenting paths
+      ValNode<View>** mv = r.alloc<ValNode<View>*>(n_view);
+      for (int i = n_view; i--; )
+        mv[i] = view[i]->matched() ? view[i]->edge_fst()->val(view[i]) : NULL;
+      typename ViewValGraph::Graph<View>::ViewNodeStack m(r,n_view);
+      while (!re.empty())
+        if (!match(m,re.pop()))
+          return false;
+      for (int i = n_view; i--; )
+        if (view[i]->edge_fst()->val(view[i]) != mv[i])
+          ac[n_ac++] = view[i]->comp;
+    }
+
+    // Mark all views in affected components for recomputation
+    if (n_ac > 0) {
+      Support::quicksort<unsigned int>(ac,n_ac);
+      for (int i = n_view; i--; )
+        if (view[i]->comp != 0) {
+          int lo=0, hi=n_ac-1;
+          while (lo < hi) {
+            int m = lo + (hi-lo) / 2;
+            if (ac[m] < view[i]->comp)
+              lo = m+1;
+            else
+              hi = m;
+          }
+          if (ac[lo] == view[i]->comp)
+            view[i]->comp = 0;
+        }
+    }
     return true;
   }
 
@@ -180,6 +307,8 @@ namespace Gecode { namespace Int { namespace Distinct {
 
     Region r(home);
 
+    // Views visited from free values
+    ViewNode<View>** vv = r.alloc<ViewNode<View>*>(n_view);
     int n_view_visited = 0;
     {
       // Marks all edges as used that are on simple paths in the graph
@@ -214,7 +343,7 @@ namespace Gecode { namespace Int { namespace Distinct {
           e->use();
           ViewNode<View>* x = e->view(n);
           if (x->min < count) {
-            n_view_visited++;
+            vv[n_view_visited++] = x;
             x->min = count;
             assert(x->edge_fst()->next() == x->edge_lst());
             ValNode<View>* m = x->edge_fst()->val(x);
@@ -230,9 +359,22 @@ namespace Gecode { namespace Int { namespace Distinct {
 
     // If all view nodes have been visited, also all edges are used!
     if (n_view_visited < n_view) {
+      /*
+       * Views with a non-zero component belong to a component that
+       * has not been affected by changes: it is still strongly
+       * connected and has no edges to other components.
+       */
+      for (int i = n_view; i--; )
+        if (view[i]->comp != 0)
+          view[i]->min = count;
       scc(home);
+      // Views reachable from a free value must be considered again
+      for (int i = n_view_visited; i--; )
+        vv[i]->comp = 0;
       return true;
     } else {
+      for (int i = n_view; i--; )
+        view[i]->comp = 0;
       return false;
     }
   }
@@ -255,6 +397,18 @@ namespace Gecode { namespace Int { namespace Distinct {
       } else {
         IterPruneVal<View> pv(view[i]);
         GECODE_ME_CHECK(view[i]->view().minus_v(home,pv,false));
+        // Remove pruned edges such that the node is synchronized
+        unsigned int n = 0;
+        Edge<View>** p = x->val_edges_ref();
+        for (Edge<View>* e = *p; e != NULL; e = e->next_edge())
+          if (e->used(x)) {
+            *p = e; p = e->next_edge_ref(); n++;
+          } else {
+            e->unlink(); e->mark();
+          }
+        *p = NULL;
+        if (n == x->view().size())
+          x->update();
       }
     }
     return ES_OK;
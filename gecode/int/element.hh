@@ -194,6 +194,104 @@ namespace Gecode { namespace Int { namespace Element {
     virtual size_t dispose(Space& home);
   };
 
+  /**
+   * \brief %Element propagator for large array of integers
+   *
+   * The array is represented by an immutable index that maps each
+   * index to the rank of its value and each value to the sorted
+   * indices at which it occurs. The index is computed once when the
+   * propagator is posted and is shared by all copies of the
+   * propagator (also by copies in different threads). Each copy
+   * only stores the values that still have support, so that cloning
+   * is proportional to the number of remaining values rather than to
+   * the size of the array.
+   *
+   * Requires \code #include <gecode/int/element.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class V0, class V1>
+  class Large : public Propagator {
+  protected:
+    /// Shared immutable index for an array of integers
+    class Index : public SharedHandle {
+    protected:
+      /// The actual index
+      class IndexObject : public SharedHandle::Object {
+      public:
+        /// Number of indices
+        int n_idx;
+        /// Number of different values
+        int n_val;
+        /// The different values in increasing order
+        int* val;
+        /// The rank of the value for each index
+        int* rank;
+        /// Start of indices for each value in \a idx (plus sentinel)
+        int* fst;
+        /// Indices sorted by value first and by index second
+        int* idx;
+        /// Initialize from array \a c
+        IndexObject(const IntSharedArray& c);
+        /// Never copied (immutable)
+        virtual SharedHandle::Object* copy(void) const;
+        /// The index is immutable
+        virtual bool immutable(void) const;
+        /// Delete object
+        virtual ~IndexObject(void);
+      };
+      /// Return index object
+      const IndexObject& io(void) const;
+    public:
+      /// Default constructor
+      Index(void);
+      /// Initialize from array \a c
+      Index(const IntSharedArray& c);
+      /// Copy constructor
+      Index(const Index& i);
+      /// Return number of different values
+      int values(void) const;
+      /// Return value with rank \a k
+      int val(int k) const;
+      /// Return rank of value at index \a i
+      int rank(int i) const;
+      /// Return first index with value of rank \a k
+      const int* fst(int k) const;
+      /// Return position after last index with value of rank \a k
+      const int* lst(int k) const;
+    };
+    /// View for index
+    V0 x0;
+    /// Size of \a x0 at last execution
+    unsigned int s0;
+    /// View for result
+    V1 x1;
+    /// Size of \a x1 at last execution
+    unsigned int s1;
+    /// The shared index for the array
+    Index ix;
+    /// Ranks of the values with support in increasing order
+    int* live;
+    /// Number of values with support
+    int n_live;
+    /// Constructor for cloning \a p
+    Large(Space& home, bool shared, Large& p);
+    /// Constructor for creation
+    Large(Home home, const Index& ix, V0 x0, V1 x1);
+  public:
+    /// Perform copying during cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Cost function (defined as high binary)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for \f$i_{x_0}=x_1\f$
+    static  ExecStatus post(Home home, IntSharedArray& i, V0 x0, V1 x1);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
   /// Post propagator with apropriate index and value types
   template<class V0, class V1>
   ExecStatus post_int(Home home, IntSharedArray& c, V0 x0, V1 x1);
@@ -323,6 +421,7 @@ namespace Gecode { namespace Int { namespace Element {
 }}}
 
 #include <gecode/int/element/int.hpp>
+#include <gecode/int/element/large.hpp>
 #include <gecode/int/element/view.hpp>
 #include <gecode/int/element/pair.hpp>
 
@@ -421,6 +421,9 @@ namespace Gecode { namespace Int { namespace Element {
     GECODE_ME_CHECK(x1.lq(home,max));
     Support::IntType val_type =
       std::max(Support::s_type(min),Support::s_type(max));
+    // Larger arrays use an index shared by all copies of the propagator
+    if ((idx_type != Support::IT_CHAR) && !shared(x0,x1))
+      return Large<V0,V1>::post(home,c,x0,x1);
     switch (idx_type) {
     case Support::IT_CHAR:
       switch (val_type) {
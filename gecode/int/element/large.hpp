@@ -0,0 +1,317 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace Element {
+
+  /// Sort indices by value first and index second
+  class ByValIdx {
+  protected:
+    /// The array of integers
+    const IntSharedArray& c;
+  public:
+    /// Initialize with array \a c
+    ByValIdx(const IntSharedArray& c);
+    /// Compare indices \a i and \a j
+    bool operator ()(int i, int j) const;
+  };
+
+  forceinline
+  ByValIdx::ByValIdx(const IntSharedArray& c0) : c(c0) {}
+  forceinline bool
+  ByValIdx::operator ()(int i, int j) const {
+    return (c[i] < c[j]) || ((c[i] == c[j]) && (i < j));
+  }
+
+
+  /*
+   * The shared index
+   *
+   */
+  template<class V0, class V1>
+  Large<V0,V1>::Index::IndexObject::IndexObject(const IntSharedArray& c)
+    : n_idx(c.size()), n_val(0),
+      rank(heap.alloc<int>(c.size())), idx(heap.alloc<int>(c.size())) {
+    for (int i=n_idx; i--; )
+      idx[i]=i;
+    ByValIdx by_val_idx(c);
+    Support::quicksort<int>(idx,n_idx,by_val_idx);
+    // Count different values
+    for (int i=0; i<n_idx; i++)
+      if ((i == 0) || (c[idx[i-1]] != c[idx[i]]))
+        n_val++;
+    val = heap.alloc<int>(n_val);
+    fst = heap.alloc<int>(n_val+1);
+    int k=-1;
+    for (int i=0; i<n_idx; i++) {
+      if ((i == 0) || (c[idx[i-1]] != c[idx[i]])) {
+        k++; val[k]=c[idx[i]]; fst[k]=i;
+      }
+      rank[idx[i]]=k;
+    }
+    fst[n_val]=n_idx;
+  }
+  template<class V0, class V1>
+  SharedHandle::Object*
+  Large<V0,V1>::Index::IndexObject::copy(void) const {
+    GECODE_NEVER;
+    return NULL;
+  }
+  template<class V0, class V1>
+  forceinline bool
+  Large<V0,V1>::Index::IndexObject::immutable(void) const {
+    return true;
+  }
+  template<class V0, class V1>
+  Large<V0,V1>::Index::IndexObject::~IndexObject(void) {
+    heap.free<int>(rank,n_idx);
+    heap.free<int>(idx,n_idx);
+    heap.free<int>(val,n_val);
+    heap.free<int>(fst,n_val+1);
+  }
+
+  template<class V0, class V1>
+  forceinline
+  Large<V0,V1>::Index::Index(void) {}
+  template<class V0, class V1>
+  forceinline
+  Large<V0,V1>::Index::Index(const IntSharedArray& c)
+    : SharedHandle(new IndexObject(c)) {}
+  template<class V0, class V1>
+  forceinline
+  Large<V0,V1>::Index::Index(const Index& i)
+    : SharedHandle(i) {}
+  template<class V0, class V1>
+  forceinline const typename Large<V0,V1>::Index::IndexObject&
+  Large<V0,V1>::Index::io(void) const {
+    return *static_cast<const IndexObject*>(object());
+  }
+  template<class V0, class V1>
+  forceinline int
+  Large<V0,V1>::Index::values(void) const {
+    return io().n_val;
+  }
+  template<class V0, class V1>
+  forceinline int
+  Large<V0,V1>::Index::val(int k) const {
+    return io().val[k];
+  }
+  template<class V0, class V1>
+  forceinline int
+  Large<V0,V1>::Index::rank(int i) const {
+    return io().rank[i];
+  }
+  template<class V0, class V1>
+  forceinline const int*
+  Large<V0,V1>::Index::fst(int k) const {
+    return io().idx + io().fst[k];
+  }
+  template<class V0, class V1>
+  forceinline const int*
+  Large<V0,V1>::Index::lst(int k) const {
+    return io().idx + io().fst[k+1];
+  }
+
+
+  /*
+   * Element propagator proper
+   *
+   */
+  template<class V0, class V1>
+  forceinline
+  Large<V0,V1>::Large(Home home, const Index& ix0, V0 y0, V1 y1)
+    : Propagator(home), x0(y0), s0(0), x1(y1), s1(0), ix(ix0),
+      live(static_cast<Space&>(home).alloc<int>(ix0.values())),
+      n_live(ix0.values()) {
+    for (int k=n_live; k--; )
+      live[k]=k;
+    home.notice(*this,AP_DISPOSE);
+    x0.subscribe(home,*this,PC_INT_DOM);
+    x1.subscribe(home,*this,PC_INT_DOM);
+  }
+
+  template<class V0, class V1>
+  forceinline size_t
+  Large<V0,V1>::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    x0.cancel(home,*this,PC_INT_DOM);
+    x1.cancel(home,*this,PC_INT_DOM);
+    ix.~Index();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class V0, class V1>
+  ExecStatus
+  Large<V0,V1>::post(Home home, IntSharedArray& c, V0 x0, V1 x1) {
+    if (x0.assigned() || x1.assigned())
+      return Int<V0,V1,int,int>::post(home,c,x0,x1);
+    Index ix(c);
+    (void) new (home) Large<V0,V1>(home,ix,x0,x1);
+    return ES_OK;
+  }
+
+  template<class V0, class V1>
+  forceinline
+  Large<V0,V1>::Large(Space& home, bool share, Large& p)
+    : Propagator(home,share,p), s0(p.s0), s1(p.s1),
+      live(home.alloc<int>(p.n_live)), n_live(p.n_live) {
+    ix.update(home,share,p.ix);
+    x0.update(home,share,p.x0);
+    x1.update(home,share,p.x1);
+    for (int k=n_live; k--; )
+      live[k]=p.live[k];
+  }
+
+  template<class V0, class V1>
+  Actor*
+  Large<V0,V1>::copy(Space& home, bool share) {
+    return new (home) Large<V0,V1>(home,share,*this);
+  }
+
+  template<class V0, class V1>
+  PropCost
+  Large<V0,V1>::cost(const Space&, const ModEventDelta& med) const {
+    if ((V0::me(med) == ME_INT_VAL) ||
+        (V1::me(med) == ME_INT_VAL))
+      return PropCost::unary(PropCost::LO);
+    else
+      return PropCost::binary(PropCost::HI);
+  }
+
+  template<class V0, class V1>
+  void
+  Large<V0,V1>::reschedule(Space& home) {
+    x0.reschedule(home,*this,PC_INT_DOM);
+    x1.reschedule(home,*this,PC_INT_DOM);
+  }
+
+  template<class V0, class V1>
+  ExecStatus
+  Large<V0,V1>::propagate(Space& home, const ModEventDelta&) {
+    if (x0.assigned()) {
+      GECODE_ME_CHECK(x1.eq(home,ix.val(ix.rank(x0.val()))));
+      return home.ES_SUBSUMED(*this);
+    }
+
+    Region r(home);
+
+    // Whether the index has changed since the last execution
+    bool idx_changed = (x0.size() != s0);
+
+    if (x1.size() != s1) {
+      // Remove values not in x1 any longer and count their indices
+      int* rm = r.alloc<int>(n_live);
+      int n_rm = 0;
+      unsigned int n_rm_idx = 0;
+      {
+        int j = 0;
+        ViewRanges<V1> v(x1);
+        for (int k=0; k<n_live; k++) {
+          int l = live[k];
+          int w = ix.val(l);
+          while (v() && (v.max() < w))
+            ++v;
+          if (v() && (v.min() <= w)) {
+            live[j++]=l;
+          } else {
+            rm[n_rm++]=l;
+            n_rm_idx += static_cast<unsigned int>(ix.lst(l) - ix.fst(l));
+          }
+        }
+        n_live = j;
+      }
+      if (n_live == 0)
+        return ES_FAILED;
+      if (n_rm > 0) {
+        if (n_rm_idx < x0.size()) {
+          // Few indices lose their value: remove them from x0
+          int* ri = r.alloc<int>(n_rm_idx);
+          int n_ri = 0;
+          for (int k=0; k<n_rm; k++)
+            for (const int* i=ix.fst(rm[k]); i<ix.lst(rm[k]); i++)
+              ri[n_ri++]=*i;
+          Support::quicksort<int>(ri,n_ri);
+          Iter::Values::Array iri(ri,n_ri);
+          GECODE_ME_CHECK(x0.minus_v(home,iri,false));
+        } else {
+          // Otherwise keep the indices whose value is still supported
+          Support::BitSet<Region> l(r,static_cast<unsigned int>
+                                    (ix.values()));
+          for (int k=0; k<n_live; k++)
+            l.set(static_cast<unsigned int>(live[k]));
+          int* ki = r.alloc<int>(x0.size());
+          int n_ki = 0;
+          for (ViewValues<V0> i(x0); i(); ++i)
+            if (l.get(static_cast<unsigned int>(ix.rank(i.val()))))
+              ki[n_ki++]=i.val();
+          Iter::Values::Array iki(ki,n_ki);
+          GECODE_ME_CHECK(x0.narrow_v(home,iki,false));
+        }
+      }
+    }
+
+    if (idx_changed) {
+      // Keep only values that are supported by some index
+      Support::BitSet<Region> s(r,static_cast<unsigned int>(ix.values()));
+      for (ViewValues<V0> i(x0); i(); ++i)
+        s.set(static_cast<unsigned int>(ix.rank(i.val())));
+      int j = 0;
+      for (int k=0; k<n_live; k++)
+        if (s.get(static_cast<unsigned int>(live[k])))
+          live[j++]=live[k];
+      n_live = j;
+      if (x1.size() != static_cast<unsigned int>(n_live)) {
+        int* v = r.alloc<int>(n_live);
+        for (int k=0; k<n_live; k++)
+          v[k]=ix.val(live[k]);
+        Iter::Values::Array iv(v,n_live);
+        GECODE_ME_CHECK(x1.narrow_v(home,iv,false));
+      }
+    }
+
+    if (x0.assigned() || x1.assigned())
+      return home.ES_SUBSUMED(*this);
+
+    s0 = x0.size();
+    s1 = x1.size();
+    return ES_FIX;
+  }
+
+}}}
+
+// STATISTICS: int-prop
+
@@ -71,7 +71,7 @@ namespace Gecode {
       throw ArgumentSizeMismatch("Int::extensional");
     GECODE_POST;
 
-    if (t.tuples()==0) {
+    if ((t.tuples() == 0) && (t.ranges() == 0)) {
       if (x.size()!=0) {
         home.fail();
       }
@@ -80,7 +80,8 @@ namespace Gecode {
 
     // Construct view array
     ViewArray<IntView> xv(home,x);
-    if (ipl & IPL_MEMORY) {
+    // Only the compact table propagator supports tuples with ranges
+    if ((ipl & IPL_MEMORY) && (t.ranges() == 0)) {
       if (x.same(home)) {
         GECODE_ES_FAIL((Extensional::Basic<IntView,true>
                              ::post(home,xv,t)));
@@ -88,9 +89,15 @@ namespace Gecode {
         GECODE_ES_FAIL((Extensional::Basic<IntView,false>
                              ::post(home,xv,t)));
       }
-    } else {
+    } else if ((ipl & IPL_BASIC) && (t.ranges() == 0)) {
       GECODE_ES_FAIL((Extensional::Incremental<IntView>
                            ::post(home,xv,t)));
+    } else if (x.same(home)) {
+      GECODE_ES_FAIL((Extensional::Compact<IntView,true>
+                           ::post(home,xv,t)));
+    } else {
+      GECODE_ES_FAIL((Extensional::Compact<IntView,false>
+                           ::post(home,xv,t)));
     }
   }
 
@@ -104,7 +111,7 @@ namespace Gecode {
       throw ArgumentSizeMismatch("Int::extensional");
     GECODE_POST;
 
-    if (t.tuples()==0) {
+    if ((t.tuples() == 0) && (t.ranges() == 0)) {
       if (x.size()!=0) {
         home.fail();
       }
@@ -113,7 +120,8 @@ namespace Gecode {
 
     // Construct view array
     ViewArray<BoolView> xv(home,x);
-    if (ipl & IPL_MEMORY) {
+    // Only the compact table propagator supports tuples with ranges
+    if ((ipl & IPL_MEMORY) && (t.ranges() == 0)) {
       if (x.same(home)) {
         GECODE_ES_FAIL((Extensional::Basic<BoolView,true>
                              ::post(home,xv,t)));
@@ -121,9 +129,15 @@ namespace Gecode {
         GECODE_ES_FAIL((Extensional::Basic<BoolView,false>
                              ::post(home,xv,t)));
       }
-    } else {
+    } else if ((ipl & IPL_BASIC) && (t.ranges() == 0)) {
       GECODE_ES_FAIL((Extensional::Incremental<BoolView>
                            ::post(home,xv,t)));
+    } else if (x.same(home)) {
+      GECODE_ES_FAIL((Extensional::Compact<BoolView,true>
+                           ::post(home,xv,t)));
+    } else {
+      GECODE_ES_FAIL((Extensional::Compact<BoolView,false>
+                           ::post(home,xv,t)));
     }
   }
 
@@ -245,7 +245,8 @@ namespace Gecode { namespace Int { namespace Extensional {
   protected:
     ViewArray<View> x; ///< Variables
     TupleSet tupleSet; ///< Definition of constraint
-    Tuple** last_data; ///< Last tuple looked at
+    /// Last tuple looked at (as position in tuple data)
+    CowArray<unsigned int> last_data;
     /// Access real tuple-set
     TupleSet::TupleSetI* ts(void);
 
@@ -254,7 +255,7 @@ namespace Gecode { namespace Int { namespace Extensional {
     /// Constructor for posting
     Base(Home home, ViewArray<View>& x, const TupleSet& t);
     /// Initialize last support
-    void init_last(Space& home, Tuple** source, Tuple* base);
+    void init_last(Space& home);
     /// Find last support for view at position \a i and value \a n
     Tuple last(int i, int n);
     /// Find last support for view at position \a i and value \a n
@@ -506,6 +507,123 @@ namespace Gecode { namespace Int { namespace Extensional {
 #include <gecode/int/extensional/incremental.hpp>
 
 
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /**
+   * \brief Domain consistent extensional propagator based on compact tables
+   *
+   * The tuples that are still valid with respect to the current
+   * domains are maintained as a sparse bitset: only words with at
+   * least one bit set are kept, so that the cost of propagation
+   * decreases as the number of valid tuples decreases. For each
+   * position and value, the tuple set provides the bitset of tuples
+   * with that value at that position (see TupleSet::TupleSetI). The
+   * bitset of valid tuples is updated by combining these bitsets
+   * word-wise, either for the removed values (incremental update) or
+   * for the remaining values (reset update). Tuples with ranges are
+   * supported directly: a tuple with ranges is a support for all values
+   * in its ranges and is valid as long as each range contains a value
+   * of the respective view. The algorithm is based on:
+   *   Jordan Demeulenaere, Renaud Hartert, Christophe Lecoutre,
+   *   Guillaume Perez, Laurent Perron, Jean-Charles R\'egin,
+   *   Pierre Schaus, Compact-Table: Efficiently Filtering Table
+   *   Constraints with Reversible Sparse Bit-Sets, CP 2016.
+   *   Pages 207-223, LNCS 9892, Springer-Verlag, 2016.
+   *
+   * If \a shared is true, the same view can occur multiply.
+   *
+   * Requires \code #include <gecode/int/extensional.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class View, bool shared>
+  class Compact : public Propagator {
+  protected:
+    /// Advisor for recording the values removed from a view
+    class CTAdvisor : public Advisor {
+    public:
+      /// Position of view
+      int i;
+      /// Smallest and largest value removed since last propagation
+      int rmin, rmax;
+      /// Create advisor for view at position \a i
+      CTAdvisor(Space& home, Propagator& p, Council<CTAdvisor>& c, int i);
+      /// Clone advisor \a a
+      CTAdvisor(Space& home, bool share, CTAdvisor& a);
+      /// Whether values have been removed since last propagation
+      bool modified(void) const;
+      /// Record that values between \a l and \a u might have been removed
+      void removed(int l, int u);
+      /// Forget about removed values
+      void reset(void);
+      /// Dispose advisor
+      void dispose(Space& home, Council<CTAdvisor>& c);
+    };
+    /// Type of a word
+    typedef Support::BitSetData Word;
+    /// The views
+    ViewArray<View> x;
+    /// Definition of constraint
+    TupleSet tupleSet;
+    /// The advisor council
+    Council<CTAdvisor> c;
+    /// Bitset of valid tuples (words not in \a index are zero)
+    Word* words;
+    /// Positions of the non-zero words
+    unsigned int* index;
+    /// Number of non-zero words
+    unsigned int limit;
+    /// Number of unassigned views
+    int unassigned;
+    /// Whether all values of all views have been checked for a valid tuple
+    bool filtered;
+    /// Access real tuple-set
+    TupleSet::TupleSetI* ts(void);
+    /**
+     * \brief Return support entry for view at position \a i and value \a v
+     *
+     * Values outside of the domain-values of the tuple set are only
+     * supported by wildcards.
+     */
+    unsigned int literal(int i, int v);
+    /// Combine support bitsets for view at position \a i and value \a v into \a u
+    void support(Word* u, int i, int v);
+    /// Whether value \a v for view at position \a i has a valid tuple
+    bool supported(int i, int v);
+    /**
+     * \brief Update valid tuples for view at position \a i
+     *
+     * Values between \a l and \a h might have been removed from the
+     * view, the array \a u is used as temporary storage.
+     */
+    void update(Word* u, int i, int l, int h);
+    /// Remove zero words
+    void compress(void);
+    /// Constructor for cloning \a p
+    Compact(Space& home, bool share, Compact<View,shared>& p);
+    /// Constructor for posting
+    Compact(Home home, ViewArray<View>& x, const TupleSet& t);
+  public:
+    /// Cost function (defined as low quadratic)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Post propagator for views \a x
+    static ExecStatus post(Home home, ViewArray<View>& x, const TupleSet& t);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+}}}
+
+#include <gecode/int/extensional/compact.hpp>
+
+
 #endif
 
 // STATISTICS: int-prop
@@ -48,13 +48,13 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline
   Base<View,subscribe>::Base(Home home, ViewArray<View>& x0,
                              const TupleSet& t)
-    : Propagator(home), x(x0), tupleSet(t), last_data(NULL) {
+    : Propagator(home), x(x0), tupleSet(t) {
     if (subscribe)
       x.subscribe(home, *this, PC_INT_DOM);
 
     assert(ts()->finalized());
 
-    init_last(home, ts()->last, ts()->tuple_data);
+    init_last(home);
 
     home.notice(*this,AP_DISPOSE);
   }
@@ -62,22 +62,21 @@ namespace Gecode { namespace Int { namespace Extensional {
   template<class View, bool subscribe>
   forceinline
   Base<View,subscribe>::Base(Space& home, bool share, Base<View,subscribe>& p)
-    : Propagator(home,share,p), last_data(NULL) {
+    : Propagator(home,share,p) {
     x.update(home, share, p.x);
     tupleSet.update(home, share, p.tupleSet);
-
-    init_last(home, p.last_data, p.ts()->tuple_data);
+    // Only the pages of last supports that change later are copied
+    last_data.update(home, share, p.last_data);
   }
 
   template<class View, bool subscribe>
   forceinline void
-  Base<View,subscribe>::init_last(Space& home, Tuple** source, Tuple* base) {
-    if (last_data == NULL) {
-      int literals = static_cast<int>(ts()->domsize*x.size());
-      last_data = home.alloc<Tuple*>(literals);
-      for (int i = literals; i--; )
-        last_data[i] = ts()->tuple_data+(source[i]-base);
-    }
+  Base<View,subscribe>::init_last(Space& home) {
+    int literals = static_cast<int>(ts()->domsize*x.size());
+    last_data.init(home, literals);
+    for (int i = literals; i--; )
+      last_data.write(i) =
+        static_cast<unsigned int>(ts()->last[i]-ts()->tuple_data);
   }
 
   template<class View, bool subscribe>
@@ -99,12 +98,10 @@ namespace Gecode { namespace Int { namespace Extensional {
     return PropCost::quadratic(PropCost::HI,x.size());
   }
 
-#define GECODE_LAST_TUPLE(l) (*(l))
-
   template<class View, bool subscribe>
   forceinline Tuple
   Base<View,subscribe>::last(int i, int n) {
-    return GECODE_LAST_TUPLE(last_data[(i*ts()->domsize) + n]);
+    return ts()->tuple_data[last_data[(i*ts()->domsize) + n]];
   }
 
   template<class View, bool subscribe>
@@ -113,10 +110,11 @@ namespace Gecode { namespace Int { namespace Extensional {
     assert(last(i,n) != NULL);
     assert(last(i,n)[i] == n+ts()->min);
     int pos = (i*static_cast<int>(ts()->domsize)) + n;
-    ++(last_data[pos]);
-    if (last(i,n)[i] != (n+ts()->min))
-      last_data[pos] = ts()->nullpointer;
-    return last(i,n);
+    unsigned int& l = last_data.write(pos);
+    ++l;
+    if (ts()->tuple_data[l][i] != (n+ts()->min))
+      l = static_cast<unsigned int>(ts()->nullpointer-ts()->tuple_data);
+    return ts()->tuple_data[l];
   }
 
 
@@ -139,7 +137,6 @@ namespace Gecode { namespace Int { namespace Extensional {
         return false;
     return true;
   }
-#undef GECODE_LAST_TUPLE
   template<class View, bool subscribe>
   forceinline Tuple
   Base<View,subscribe>::find_support(Domain dom, int i, int n) {
@@ -157,9 +154,7 @@ namespace Gecode { namespace Int { namespace Extensional {
     (void) Propagator::dispose(home);
     if (subscribe)
       x.cancel(home,*this,PC_INT_DOM);
-    // take care of last_data
-    unsigned int literals = ts()->domsize*x.size();
-    home.rfree(last_data, sizeof(Tuple*)*literals);
+    last_data.dispose(home);
     (void) tupleSet.~TupleSet();
     return sizeof(*this);
   }
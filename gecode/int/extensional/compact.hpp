@@ -0,0 +1,371 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /*
+   * Advisor
+   *
+   */
+
+  template<class View, bool shared>
+  forceinline
+  Compact<View,shared>::CTAdvisor::CTAdvisor(Space& home, Propagator& p,
+                                             Council<CTAdvisor>& c, int i0)
+    : Advisor(home,p,c), i(i0) {
+    reset();
+  }
+
+  template<class View, bool shared>
+  forceinline
+  Compact<View,shared>::CTAdvisor::CTAdvisor(Space& home, bool share,
+                                             CTAdvisor& a)
+    : Advisor(home,share,a), i(a.i), rmin(a.rmin), rmax(a.rmax) {}
+
+  template<class View, bool shared>
+  forceinline bool
+  Compact<View,shared>::CTAdvisor::modified(void) const {
+    return rmin <= rmax;
+  }
+
+  template<class View, bool shared>
+  forceinline void
+  Compact<View,shared>::CTAdvisor::removed(int l, int u) {
+    rmin = std::min(rmin,l); rmax = std::max(rmax,u);
+  }
+
+  template<class View, bool shared>
+  forceinline void
+  Compact<View,shared>::CTAdvisor::reset(void) {
+    rmin = Limits::max; rmax = Limits::min;
+  }
+
+  template<class View, bool shared>
+  forceinline void
+  Compact<View,shared>::CTAdvisor::dispose(Space& home,
+                                           Council<CTAdvisor>& c) {
+    Advisor::dispose(home,c);
+  }
+
+
+  /*
+   * Operations on the bitset of valid tuples
+   *
+   */
+
+  template<class View, bool shared>
+  forceinline TupleSet::TupleSetI*
+  Compact<View,shared>::ts(void) {
+    return tupleSet.implementation();
+  }
+
+  template<class View, bool shared>
+  forceinline unsigned int
+  Compact<View,shared>::literal(int i, int v) {
+    TupleSet::TupleSetI* t = ts();
+    if ((v < t->min) || (v > t->max))
+      return t->domsize*static_cast<unsigned int>(x.size()) +
+        static_cast<unsigned int>(i);
+    return static_cast<unsigned int>(i)*t->domsize +
+      static_cast<unsigned int>(v-t->min);
+  }
+
+  template<class View, bool shared>
+  forceinline void
+  Compact<View,shared>::support(Word* u, int i, int v) {
+    TupleSet::TupleSetI* t = ts();
+    unsigned int p = literal(i,v);
+    for (unsigned int j=t->s_fst[p]; j<t->s_fst[p+1]; j++)
+      u[t->s_words[j].i].o(t->s_words[j].b);
+  }
+
+  template<class View, bool shared>
+  forceinline bool
+  Compact<View,shared>::supported(int i, int v) {
+    TupleSet::TupleSetI* t = ts();
+    unsigned int p = literal(i,v);
+    for (unsigned int j=t->s_fst[p]; j<t->s_fst[p+1]; j++)
+      if (!Word::a(words[t->s_words[j].i],t->s_words[j].b).none())
+        return true;
+    return false;
+  }
+
+  template<class View, bool shared>
+  forceinline void
+  Compact<View,shared>::update(Word* u, int i, int l, int h) {
+    TupleSet::TupleSetI* t = ts();
+    /*
+     * Values outside of the domain-values are only supported by
+     * wildcards, which also support all remaining values.
+     */
+    l = std::max(l,t->min); h = std::min(h,t->max);
+    if (l > h)
+      return;
+    for (unsigned int k=0; k<limit; k++)
+      u[index[k]].init(false);
+    if (!t->r_wide[i] &&
+        (static_cast<unsigned int>(h-l) < x[i].size())) {
+      /*
+       * Incremental update: remove the tuples for the removed values
+       * (not possible if a tuple has a proper range for the view)
+       */
+      ViewRanges<View> r(x[i]);
+      for (int v=l; v<=h; v++) {
+        while (r() && (r.max() < v))
+          ++r;
+        if (r() && (r.min() <= v))
+          v = r.max();
+        else
+          support(u,i,v);
+      }
+      for (unsigned int k=0; k<limit; k++)
+        words[index[k]].n(u[index[k]]);
+    } else {
+      // Reset update: keep the tuples for the remaining values
+      bool outside = false;
+      for (ViewRanges<View> r(x[i]); r(); ++r) {
+        for (int v=std::max(r.min(),t->min); v<=std::min(r.max(),t->max); v++)
+          support(u,i,v);
+        if ((r.min() < t->min) || (r.max() > t->max))
+          outside = true;
+      }
+      if (outside)
+        support(u,i,t->max+1);
+      for (unsigned int k=0; k<limit; k++)
+        words[index[k]].a(u[index[k]]);
+    }
+  }
+
+  template<class View, bool shared>
+  forceinline void
+  Compact<View,shared>::compress(void) {
+    for (unsigned int k=limit; k--; )
+      if (words[index[k]].none())
+        index[k] = index[--limit];
+  }
+
+
+  /*
+   * The propagator proper
+   *
+   */
+
+  template<class View, bool shared>
+  forceinline
+  Compact<View,shared>::Compact(Home home, ViewArray<View>& x0,
+                                const TupleSet& t)
+    : Propagator(home), x(x0), tupleSet(t), c(home),
+      unassigned(x.size()), filtered(false) {
+    home.notice(*this,AP_DISPOSE);
+    // Initially, all tuples are valid
+    unsigned int n = ts()->n_words;
+    words = static_cast<Space&>(home).alloc<Word>(n);
+    index = static_cast<Space&>(home).alloc<unsigned int>(n);
+    for (unsigned int w=0; w<n; w++) {
+      words[w].init(true); index[w] = w;
+    }
+    for (unsigned int b=static_cast<unsigned int>(t.tuples()+t.ranges());
+         b<n*Word::bpb; b++)
+      words[n-1].clear(b % Word::bpb);
+    limit = n;
+
+    Region r(home);
+    Word* u = r.alloc<Word>(n);
+    for (int i = x.size(); i--; ) {
+      update(u,i,Limits::min,Limits::max);
+      if (x[i].assigned())
+        --unassigned;
+      else
+        x[i].subscribe(home,*new (home) CTAdvisor(home,*this,c,i));
+    }
+    compress();
+    // Boolean views only schedule for assignment
+    View::schedule(home,*this,ME_INT_VAL);
+  }
+
+  template<class View, bool shared>
+  forceinline ExecStatus
+  Compact<View,shared>::post(Home home, ViewArray<View>& x,
+                             const TupleSet& t) {
+    // Values outside of the domain-values are pruned by propagation
+    (void) new (home) Compact<View,shared>(home,x,t);
+    return ES_OK;
+  }
+
+  template<class View, bool shared>
+  forceinline
+  Compact<View,shared>::Compact(Space& home, bool share,
+                                Compact<View,shared>& p)
+    : Propagator(home,share,p), limit(p.limit), unassigned(p.unassigned),
+      filtered(p.filtered) {
+    x.update(home,share,p.x);
+    tupleSet.update(home,share,p.tupleSet);
+    c.update(home,share,p.c);
+    // Only the non-zero words are copied
+    unsigned int n = ts()->n_words;
+    words = home.alloc<Word>(n);
+    for (unsigned int w=0; w<n; w++)
+      words[w].init(false);
+    index = home.alloc<unsigned int>(limit);
+    for (unsigned int k=0; k<limit; k++) {
+      index[k] = p.index[k]; words[index[k]] = p.words[index[k]];
+    }
+  }
+
+  template<class View, bool shared>
+  Actor*
+  Compact<View,shared>::copy(Space& home, bool share) {
+    return new (home) Compact<View,shared>(home,share,*this);
+  }
+
+  template<class View, bool shared>
+  PropCost
+  Compact<View,shared>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::quadratic(PropCost::LO,x.size());
+  }
+
+  template<class View, bool shared>
+  void
+  Compact<View,shared>::reschedule(Space& home) {
+    View::schedule(home,*this,ME_INT_VAL);
+  }
+
+  template<class View, bool shared>
+  ExecStatus
+  Compact<View,shared>::advise(Space&, Advisor& _a, const Delta& d) {
+    CTAdvisor& a = static_cast<CTAdvisor&>(_a);
+    if (x[a.i].any(d))
+      a.removed(Limits::min,Limits::max);
+    else
+      a.removed(x[a.i].min(d),x[a.i].max(d));
+    if (View::modevent(d) == ME_INT_VAL)
+      --unassigned;
+    return ES_NOFIX;
+  }
+
+  template<class View, bool shared>
+  ExecStatus
+  Compact<View,shared>::propagate(Space& home, const ModEventDelta&) {
+    Region r(home);
+    Word* u = r.alloc<Word>(ts()->n_words);
+
+    // Update valid tuples for all modified views
+    int n_mod = 0, i_mod = -1;
+    for (Advisors<CTAdvisor> as(c); as(); ++as) {
+      CTAdvisor& a = as.advisor();
+      if (a.modified()) {
+        update(u,a.i,a.rmin,a.rmax);
+        a.reset();
+        n_mod++; i_mod = a.i;
+      }
+    }
+    compress();
+
+    if (limit == 0)
+      return ES_FAILED;
+    if (unassigned == 0)
+      return home.ES_SUBSUMED(*this);
+
+    // Remove values without a valid tuple
+    bool pruned = false;
+    for (int i = x.size(); i--; ) {
+      /*
+       * If only a single view has been modified since all values have
+       * been filtered, all its values are still supported: the only
+       * tuples that became invalid have values for that view that have
+       * been removed.
+       */
+      if (x[i].assigned() || (filtered && (n_mod == 1) && (i == i_mod)))
+        continue;
+      TupleSet::TupleSetI* t = ts();
+      // Values outside of the domain-values are only supported by wildcards
+      if (((x[i].min() < t->min) || (x[i].max() > t->max)) &&
+          !supported(i,t->max+1)) {
+        ModEvent me = x[i].gq(home,t->min);
+        GECODE_ME_CHECK(me);
+        pruned |= me_modified(me);
+        me = x[i].lq(home,t->max);
+        GECODE_ME_CHECK(me);
+        pruned |= me_modified(me);
+      }
+      unsigned int s = std::min(x[i].size(),t->domsize);
+      int* nq = r.alloc<int>(s);
+      int n = 0;
+      for (ViewRanges<View> rx(x[i]); rx(); ++rx)
+        for (int v=std::max(rx.min(),t->min);
+             v<=std::min(rx.max(),t->max); v++)
+          if (!supported(i,v))
+            nq[n++] = v;
+      if (n > 0) {
+        Iter::Values::Array nqi(nq,n);
+        GECODE_ME_CHECK(x[i].minus_v(home,nqi,false));
+        pruned = true;
+      }
+      r.free<int>(nq,s);
+    }
+    filtered = true;
+
+    if (shared) {
+      /*
+       * Removing a value for one position of a shared view might
+       * invalidate tuples for another position of the same view.
+       */
+      if (pruned)
+        return ES_NOFIX;
+    } else {
+      // Removing values without a valid tuple leaves the tuples valid
+      for (Advisors<CTAdvisor> as(c); as(); ++as)
+        as.advisor().reset();
+      if (unassigned == 0)
+        return home.ES_SUBSUMED(*this);
+    }
+    return ES_FIX;
+  }
+
+  template<class View, bool shared>
+  size_t
+  Compact<View,shared>::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    c.dispose(home);
+    (void) tupleSet.~TupleSet();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -80,12 +80,19 @@ namespace Gecode {
     virtual ~DFAI(void);
     /// Create a copy
     GECODE_INT_EXPORT virtual SharedHandle::Object* copy(void) const;
+    /// Automata are immutable (never copied)
+    virtual bool immutable(void) const;
   };
 
   forceinline
   DFA::DFAI::DFAI(int nt)
     : trans(nt == 0 ? NULL : heap.alloc<Transition>(nt)) {}
 
+  forceinline bool
+  DFA::DFAI::immutable(void) const {
+    return true;
+  }
+
   forceinline
   DFA::DFAI::~DFAI(void) {
     if (n_trans > 0)
@@ -88,6 +88,29 @@ namespace {
     }
   };
 
+  typedef ::Gecode::TupleSet::TupleSetI::SupportWord SupportWord;
+
+  /**
+   * \brief Add bit \a k to the support words for literal \a p
+   *
+   * The last word for each literal is \a lw and the next support word
+   * is \a nw. If \a s is NULL, the support words are only counted.
+   */
+  forceinline void
+  support(SupportWord* s, unsigned int* lw, unsigned int* nw,
+          unsigned int p, unsigned int k) {
+    unsigned int bpb = ::Gecode::Support::BitSetData::bpb;
+    if (k / bpb != lw[p]) {
+      lw[p] = k / bpb;
+      if (s != NULL) {
+        s[nw[p]].i = k / bpb; s[nw[p]].b.init(false);
+      }
+      nw[p]++;
+    }
+    if (s != NULL)
+      s[nw[p]-1].b.set(k % bpb);
+  }
+
 }
 
 namespace Gecode {
@@ -97,6 +120,10 @@ namespace Gecode {
     assert(!finalized());
     assert(tuples == NULL);
 
+    // Tuples with only wildcards: wildcards support all other values
+    if (min > max)
+      min = max = 0;
+
     // Add final largest tuple
     IntArgs ia(arity);
     for (int i = arity; i--; )
@@ -108,6 +135,19 @@ namespace Gecode {
     // Domainsize
     domsize = static_cast<unsigned int>(max - min) + 1;
 
+    // Find positions with proper ranges or wildcards (wildcards are kept)
+    r_excess = -1;
+    r_wide = heap.alloc<bool>(arity);
+    for (int i = arity; i--; )
+      r_wide[i] = false;
+    for (int r = r_size; r--; )
+      for (int i = arity; i--; ) {
+        int l = r_data[2*r*arity+i];
+        int u = r_data[(2*r+1)*arity+i];
+        if ((l == TupleSet::any) || (l < u))
+          r_wide[i] = true;
+      }
+
     // Allocate tuple indexing data-structures
     tuples = heap.alloc<Tuple*>(arity);
     tuple_data = heap.alloc<Tuple>(size*arity+1);
@@ -158,6 +198,63 @@ namespace Gecode {
       }
     }
 
+    /*
+     * Set up support bitsets: the tuple at position t in data (without
+     * the final largest tuple) corresponds to bit t, the tuple with
+     * ranges at position r to bit size-1+r. The bits for a value are
+     * visited in increasing order, so that bits sharing a word are
+     * adjacent. The first pass counts the words, the second sets them.
+     * The wildcards at position i also support the values outside of
+     * the domain-values (entry n_lit+i).
+     */
+    unsigned int n_plain = static_cast<unsigned int>(size-1);
+    unsigned int n_lit = domsize*static_cast<unsigned int>(arity);
+    unsigned int n_fst = n_lit+static_cast<unsigned int>(arity);
+    n_words = Support::BitSetData::data(n_plain +
+                                        static_cast<unsigned int>(r_size));
+    s_fst = heap.alloc<unsigned int>(n_fst+1);
+    // Last word and next support word for each position and value
+    unsigned int* lw = heap.alloc<unsigned int>(n_fst);
+    unsigned int* nw = heap.alloc<unsigned int>(n_fst);
+    for (unsigned int p = 0; p < n_fst; p++)
+      nw[p] = 0;
+    for (int pass = 0; pass < 2; pass++) {
+      for (unsigned int p = 0; p < n_fst; p++)
+        lw[p] = n_words;
+      for (int i = 0; i < arity; i++)
+        for (unsigned int d = 0; d < domsize; d++) {
+          unsigned int p = (i*domsize) + d;
+          for (Tuple* t = last[p];
+               (*t != NULL) && ((*t)[i] == static_cast<int>(min+d)); t++)
+            support(s_words, lw, nw, p,
+                    static_cast<unsigned int>((*t)-data) / arity);
+        }
+      for (int r = 0; r < r_size; r++)
+        for (int i = 0; i < arity; i++) {
+          int l = r_data[2*r*arity+i];
+          int u = r_data[(2*r+1)*arity+i];
+          if (l == TupleSet::any) {
+            support(s_words, lw, nw, n_lit + static_cast<unsigned int>(i),
+                    n_plain + static_cast<unsigned int>(r));
+            l = min; u = max;
+          }
+          for (int v = l; v <= u; v++)
+            support(s_words, lw, nw,
+                    (i*domsize) + static_cast<unsigned int>(v-min),
+                    n_plain + static_cast<unsigned int>(r));
+        }
+      if (pass == 0) {
+        unsigned int n_s = 0;
+        for (unsigned int p = 0; p < n_fst; p++) {
+          s_fst[p] = n_s; n_s += nw[p]; nw[p] = s_fst[p];
+        }
+        s_fst[n_fst] = n_s;
+        s_words = heap.alloc<SupportWord>(std::max(n_s,1U));
+      }
+    }
+    heap.rfree(lw);
+    heap.rfree(nw);
+
     assert(finalized());
   }
 
@@ -169,6 +266,15 @@ namespace Gecode {
     excess = ndatasize - size;
   }
 
+  void
+  TupleSet::TupleSetI::r_resize(void) {
+    assert(r_excess == 0);
+    int ndatasize = static_cast<int>(1+r_size*1.5);
+    r_data = heap.realloc<int>(r_data, 2 * r_size * arity,
+                               2 * ndatasize * arity);
+    r_excess = ndatasize - r_size;
+  }
+
   SharedHandle::Object*
   TupleSet::TupleSetI::copy(void) const {
     assert(finalized());
@@ -205,6 +311,23 @@ namespace Gecode {
       d->last[i] = d->tuple_data + (last[i]-tuple_data);
     }
 
+    // Tuples with ranges
+    d->r_size = r_size;
+    d->r_excess = r_excess;
+    d->r_data = heap.alloc<int>(std::max(2*r_size*arity,1));
+    heap.copy(d->r_data, r_data, 2*r_size*arity);
+    d->r_wide = heap.alloc<bool>(arity);
+    heap.copy(d->r_wide, r_wide, arity);
+
+    // Support bitsets
+    d->n_words = n_words;
+    unsigned int n_fst = (domsize+1)*static_cast<unsigned int>(arity)+1;
+    d->s_fst = heap.alloc<unsigned int>(n_fst);
+    heap.copy(d->s_fst, s_fst, n_fst);
+    unsigned int n_s = s_fst[n_fst-1];
+    d->s_words = heap.alloc<SupportWord>(std::max(n_s,1U));
+    heap.copy(d->s_words, s_words, n_s);
+
     return d;
   }
 
@@ -214,6 +337,10 @@ namespace Gecode {
     heap.rfree(tuple_data);
     heap.rfree(data);
     heap.rfree(last);
+    heap.rfree(r_data);
+    heap.rfree(r_wide);
+    heap.rfree(s_fst);
+    heap.rfree(s_words);
   }
 
 }
@@ -46,6 +46,11 @@ namespace Gecode {
     return excess == -1;
   }
 
+  forceinline bool
+  TupleSet::TupleSetI::immutable(void) const {
+    return finalized();
+  }
+
   forceinline
   TupleSet::TupleSetI::TupleSetI(void)
     : arity(-1),
@@ -58,7 +63,14 @@ namespace Gecode {
       max(Int::Limits::min),
       domsize(0),
       last(NULL),
-      nullpointer(NULL)
+      nullpointer(NULL),
+      r_size(0),
+      r_excess(0),
+      r_data(NULL),
+      r_wide(NULL),
+      n_words(0),
+      s_fst(NULL),
+      s_words(NULL)
   {}
 
 
@@ -79,6 +91,28 @@ namespace Gecode {
     ++size;
   }
 
+  template<class T>
+  void
+  TupleSet::TupleSetI::add(T l, T u) {
+    assert(arity  != -1); // Arity has been set
+    assert(excess != -1); // Tuples may still be added
+    if (r_excess == 0) r_resize();
+    assert(r_excess >= 0);
+    --r_excess;
+    int end = 2*r_size*arity;
+    for (int i = arity; i--; ) {
+      if (l[i] == TupleSet::any) {
+        // Wildcards are resolved when finalizing
+        r_data[end+i] = r_data[end+arity+i] = TupleSet::any;
+      } else {
+        r_data[end+i] = l[i]; r_data[end+arity+i] = u[i];
+        if (l[i] < min) min = l[i];
+        if (u[i] > max) max = u[i];
+      }
+    }
+    ++r_size;
+  }
+
   forceinline
   TupleSet::TupleSet(void) {
   }
@@ -104,9 +138,39 @@ namespace Gecode {
     assert(imp->arity == -1 ||
            imp->arity == tuple.size());
     imp->arity = tuple.size();
+    for (int i = tuple.size(); i--; )
+      if (tuple[i] == any) {
+        imp->add(tuple,tuple);
+        return;
+      }
     imp->add(tuple);
   }
 
+  inline void
+  TupleSet::add(const IntArgs& l, const IntArgs& u) {
+    assert(l.size() == u.size());
+    TupleSetI* imp = static_cast<TupleSetI*>(object());
+    if (imp == NULL) {
+      imp = new TupleSetI;
+      object(imp);
+    }
+    assert(imp->arity == -1 ||
+           imp->arity == l.size());
+    imp->arity = l.size();
+    bool values = true;
+    for (int i = l.size(); i--; )
+      if (l[i] == any)
+        values = false;
+      else if (l[i] > u[i])
+        return; // Tuple matches nothing
+      else if (l[i] < u[i])
+        values = false;
+    if (values)
+      imp->add(l);
+    else
+      imp->add(l,u);
+  }
+
   forceinline void
   TupleSet::finalize(void) {
     TupleSetI* imp = static_cast<TupleSetI*>(object());
@@ -152,6 +216,27 @@ namespace Gecode {
     return imp->data + i*imp->arity;
   }
   forceinline int
+  TupleSet::ranges(void) const {
+    TupleSetI* imp = static_cast<TupleSetI*>(object());
+    assert(imp);
+    assert(imp->finalized());
+    return imp->r_size;
+  }
+  forceinline TupleSet::Tuple
+  TupleSet::lower(int i) const {
+    TupleSetI* imp = static_cast<TupleSetI*>(object());
+    assert(imp);
+    assert(imp->finalized());
+    return imp->r_data + 2*i*imp->arity;
+  }
+  forceinline TupleSet::Tuple
+  TupleSet::upper(int i) const {
+    TupleSetI* imp = static_cast<TupleSetI*>(object());
+    assert(imp);
+    assert(imp->finalized());
+    return imp->r_data + (2*i+1)*imp->arity;
+  }
+  forceinline int
   TupleSet::min(void) const {
     TupleSetI* imp = static_cast<TupleSetI*>(object());
     assert(imp);
@@ -167,7 +252,7 @@ namespace Gecode {
   }
 
 
-  template<class Char, class Traits, class T>
+  template<class Char, class Traits>
   std::basic_ostream<Char,Traits>&
   operator <<(std::basic_ostream<Char,Traits>& os, const TupleSet& ts) {
     std::basic_ostringstream<Char,Traits> s;
@@ -182,6 +267,21 @@ namespace Gecode {
       }
       s << std::endl;
     }
+    if (ts.ranges() > 0) {
+      s << "Number of tuples with ranges: " << ts.ranges() << std::endl
+        << "Tuples with ranges:" << std::endl;
+      for (int i = 0; i < ts.ranges(); ++i) {
+        s << '\t';
+        for (int j = 0; j < ts.arity(); ++j)
+          if (ts.lower(i)[j] == TupleSet::any)
+            s << " *";
+          else if (ts.lower(i)[j] == ts.upper(i)[j])
+            s << " " << ts.lower(i)[j];
+          else
+            s << " " << ts.lower(i)[j] << ".." << ts.upper(i)[j];
+        s << std::endl;
+      }
+    }
     return os << s.str();
   }
 
@@ -43,6 +43,11 @@ namespace Gecode {
    * Integer sets
    *
    */
+  forceinline bool
+  IntSet::IntSetObject::immutable(void) const {
+    return true;
+  }
+
   forceinline
   IntSet::IntSet(void) {}
 
@@ -776,6 +776,158 @@ namespace Gecode { namespace Int { namespace Linear {
 #include <gecode/int/linear/int-nary.hpp>
 #include <gecode/int/linear/int-dom.hpp>
 
+namespace Gecode { namespace Int { namespace Linear {
+
+  /*
+   * Incremental n-ary propagators
+   *
+   */
+
+  /**
+   * \brief Base-class for incremental n-ary linear propagators
+   *
+   * Each term is watched by a batched advisor. The bounds of the
+   * terms that have been accounted for are kept in packed arrays.
+   * When the propagator runs, it only processes the terms that have
+   * been modified since and hence maintains the sums of the lower
+   * and upper bounds of all terms incrementally. In addition, the
+   * terms are kept in a max-heap ordered by their width: the terms
+   * that are wider than a slack form a subtree at the root of the
+   * heap, so that only the terms that can actually be pruned are
+   * considered. As widths only decrease, the heap is restored by
+   * sifting down the terms that have been modified. Assigned terms
+   * are dropped from the arrays during cloning.
+   *
+   * The type \a Val can be either \c long long int or \c int, defining
+   * the numerical precision during propagation. Positive and negative
+   * views are of type \a View.
+   */
+  template<class Val, class View>
+  class IncLin : public Propagator {
+  protected:
+    /// %Advisor for a single term
+    class Term : public BatchViewAdvisor<View> {
+    public:
+      /// Whether the term is positive
+      bool p;
+      /// Position of the term in the arrays of the propagator
+      int i;
+      /// Constructor for creation
+      Term(Space& home, Propagator& p, BatchCouncil<Term>& c,
+           View x, bool pos, int i);
+      /// Constructor for cloning \a a
+      Term(Space& home, bool share, Term& a);
+      /// Return current lower bound of the term
+      Val min(void) const;
+      /// Return current upper bound of the term
+      Val max(void) const;
+    };
+    /// The advisors for the terms that are not assigned
+    BatchCouncil<Term> co;
+    /// Number of terms
+    int n;
+    /// The advisors for the terms (NULL for disposed advisors, in heap order)
+    Term** t;
+    /// Lower bounds of the terms accounted for
+    Val* l;
+    /// Upper bounds of the terms accounted for
+    Val* u;
+    /// Constant value minus sum of lower bounds of all terms
+    Val sl;
+    /// Sum of upper bounds of all terms minus constant value
+    Val su;
+    /// Return width of term \a i
+    Val width(int i) const;
+    /// Restore heap for term \a i whose width might have decreased
+    void sift(int i);
+    /// Store positions of terms wider than \a s in \a p, return their number
+    int wider(Val s, int* p) const;
+    /// Process modified terms, return whether all terms are assigned
+    bool batch(Space& home);
+    /// Prune upper bound of term \a i with respect to slack \a s
+    ExecStatus lq(Space& home, int i, Val s);
+    /// Prune lower bound of term \a i with respect to slack \a s
+    ExecStatus gq(Space& home, int i, Val s);
+    /// Constructor for cloning \a p
+    IncLin(Space& home, bool share, IncLin& p);
+    /// Constructor for creation
+    IncLin(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+  public:
+    /// Cost function (defined as high unary)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+  /**
+   * \brief %Propagator for incremental bounds consistent n-ary linear equality
+   *
+   * Used for linear equations with many terms.
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class Val, class View>
+  class IncEq : public IncLin<Val,View> {
+  protected:
+    using IncLin<Val,View>::n;
+    using IncLin<Val,View>::l;
+    using IncLin<Val,View>::u;
+    using IncLin<Val,View>::sl;
+    using IncLin<Val,View>::su;
+    /// Constructor for cloning \a p
+    IncEq(Space& home, bool share, IncEq& p);
+  public:
+    /// Constructor for creation
+    IncEq(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for \f$\sum_{i=0}^{|x|-1}x_i-\sum_{i=0}^{|y|-1}y_i=c\f$
+    static ExecStatus
+    post(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+  };
+
+  /**
+   * \brief %Propagator for incremental bounds consistent n-ary linear less or equal
+   *
+   * Used for linear inequations with many terms.
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class Val, class View>
+  class IncLq : public IncLin<Val,View> {
+  protected:
+    using IncLin<Val,View>::n;
+    using IncLin<Val,View>::l;
+    using IncLin<Val,View>::u;
+    using IncLin<Val,View>::sl;
+    using IncLin<Val,View>::su;
+    /// Constructor for cloning \a p
+    IncLq(Space& home, bool share, IncLq& p);
+  public:
+    /// Constructor for creation
+    IncLq(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for \f$\sum_{i=0}^{|x|-1}x_i-\sum_{i=0}^{|y|-1}y_i\leq c\f$
+    static ExecStatus
+    post(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+  };
+
+  /// Minimal number of terms for which incremental propagators are used
+  const int inc_min_terms = 64;
+
+}}}
+
+#include <gecode/int/linear/int-inc.hpp>
+
 namespace Gecode { namespace Int { namespace Linear {
 
   /*
@@ -1326,6 +1478,97 @@ namespace Gecode { namespace Int { namespace Linear {
     static ExecStatus post(Home home, SBAP& p, SBAN& n, VX x, int c);
   };
 
+  /**
+   * \brief %Propagator for pseudo-Boolean inequality with watched literals
+   *
+   * Propagates \f$\sum_{i=0}^{|x|-1}|a_i|\cdot l_i\geq c\f$ where the
+   * literal \f$l_i\f$ is \f$x_i\f$ if \f$a_i>0\f$ and \f$\neg x_i\f$
+   * otherwise. The coefficients are sorted by decreasing absolute
+   * value.
+   *
+   * Only a subset of the literals that are not false is watched such
+   * that the sum of their coefficients is at least \f$c\f$ plus the
+   * largest coefficient of an unassigned literal. As long as this
+   * holds, no literal can be propagated and the propagator is not
+   * run. Only when a watched literal becomes false and no replacement
+   * can be found, the propagator performs propagation.
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  class GqBoolWatch : public Propagator {
+  protected:
+    /// %Advisor for a watched literal
+    class Watch : public Advisor {
+    public:
+      /// Index of the watched literal
+      int i;
+      /// Constructor for creation
+      Watch(Space& home, Propagator& p, Council<Watch>& c, int i);
+      /// Constructor for cloning \a a
+      Watch(Space& home, bool share, Watch& a);
+    };
+    /// The advisors for the watched literals
+    Council<Watch> co;
+    /// The Boolean views
+    ViewArray<BoolView> x;
+    /// The coefficients (negative for negated literals)
+    SharedArray<int> a;
+    /// Whether a literal is watched
+    bool* w;
+    /// Sum of coefficients of watched literals that are not false
+    long long int ws;
+    /// Sum of coefficients of watched literals that are true
+    long long int wt;
+    /// Right-hand side
+    long long int c;
+    /// All literals before this position are assigned and accounted for
+    int m;
+    /// Return coefficient of literal \a i
+    int coeff(int i) const;
+    /// Test whether literal \a i is true
+    bool one(int i) const;
+    /// Test whether literal \a i is false
+    bool zero(int i) const;
+    /// Return the largest coefficient of an unassigned literal
+    int amax(void);
+    /**
+     * \brief Watch more literals until no literal can be propagated
+     *
+     * The advisor \a r (if not NULL) is reused for the first literal
+     * watched, \a u is set to whether \a r has been reused. Returns
+     * false if not sufficiently many literals can be watched.
+     */
+    bool rewatch(Space& home, Watch* r, bool& u);
+    /// Constructor for cloning \a p
+    GqBoolWatch(Space& home, bool share, GqBoolWatch& p);
+    /// Constructor for creation
+    GqBoolWatch(Home home, ViewArray<BoolView>& x, SharedArray<int>& a,
+                long long int c);
+  public:
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Cost function (defined as low linear)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /**
+     * \brief Post propagator
+     *
+     * The coefficients \a a must be sorted by decreasing absolute value.
+     * All sums of coefficients are computed with \c long \c long \c int
+     * as they might exceed the integer limits.
+     */
+    static ExecStatus post(Home home, ViewArray<BoolView>& x,
+                           SharedArray<int>& a, long long int c);
+  };
+
 }}}
 
 #include <gecode/int/linear/bool-scale.hpp>
@@ -503,11 +503,70 @@ namespace Gecode { namespace Int { namespace Linear {
   }
 
 
+  /// Order terms by decreasing absolute value of coefficients
+  class TermAbsGreater {
+  public:
+    bool operator ()(const Term<BoolView>& x, const Term<BoolView>& y) {
+      return std::abs(x.a) > std::abs(y.a);
+    }
+  };
+
+  /**
+   * \brief Post pseudo-Boolean inequality with watched literals
+   *
+   * Posts \f$\sum_{i=0}^{n_p-1}a_i\cdot l_i+
+   * \sum_{i=0}^{n_n-1}a_i\cdot\neg l_i\geq c\f$
+   * where \f$l_i\f$ are the views of \a t_p and \a t_n, respectively.
+   */
+  forceinline void
+  post_watch(Home home,
+             Term<BoolView>* t_p, int n_p,
+             Term<BoolView>* t_n, int n_n, long long int c) {
+    Region r(home);
+    int n = n_p + n_n;
+    Term<BoolView>* t = r.alloc<Term<BoolView> >(n);
+    for (int i=n_p; i--; )
+      t[i] = t_p[i];
+    for (int i=n_n; i--; ) {
+      t[n_p+i].x = t_n[i].x; t[n_p+i].a = -t_n[i].a;
+    }
+    TermAbsGreater tag;
+    Support::quicksort<Term<BoolView>,TermAbsGreater>(t,n,tag);
+    ViewArray<BoolView> x(home,n);
+    SharedArray<int> a(n);
+    for (int i=n; i--; ) {
+      x[i] = t[i].x; a[i] = t[i].a;
+    }
+    GECODE_ES_FAIL(GqBoolWatch::post(home,x,a,c));
+  }
+
   forceinline void
   post_mixed(Home home,
              Term<BoolView>* t_p, int n_p,
              Term<BoolView>* t_n, int n_n,
              IntRelType irt, ZeroIntView y, int c) {
+    switch (irt) {
+    case IRT_LQ:
+      {
+        // Rewrite a*x as a - a*(not x) for positive coefficients
+        long long int d = -static_cast<long long int>(c);
+        for (int i=n_p; i--; )
+          d += t_p[i].a;
+        post_watch(home,t_n,n_n,t_p,n_p,d);
+      }
+      return;
+    case IRT_GQ:
+      {
+        // Rewrite -a*x as a*(not x) - a for negative coefficients
+        long long int d = c;
+        for (int i=n_n; i--; )
+          d += t_n[i].a;
+        post_watch(home,t_p,n_p,t_n,n_n,d);
+      }
+      return;
+    default:
+      break;
+    }
     ScaleBoolArray b_p(home,n_p);
     {
       ScaleBool* f=b_p.fst();
@@ -533,16 +592,6 @@ namespace Gecode { namespace Int { namespace Linear {
                      (NqBoolScale<ScaleBoolArray,ScaleBoolArray,ZeroIntView>
                       ::post(home,b_p,b_n,y,c)));
       break;
-    case IRT_LQ:
-      GECODE_ES_FAIL(
-                     (LqBoolScale<ScaleBoolArray,ScaleBoolArray,ZeroIntView>
-                      ::post(home,b_p,b_n,y,c)));
-      break;
-    case IRT_GQ:
-      GECODE_ES_FAIL(
-                     (LqBoolScale<ScaleBoolArray,ScaleBoolArray,ZeroIntView>
-                      ::post(home,b_n,b_p,y,-c)));
-      break;
     default:
       GECODE_NEVER;
     }
@@ -0,0 +1,227 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int/linear.hh>
+
+namespace Gecode { namespace Int { namespace Linear {
+
+  /*
+   * Advisors for watched literals
+   *
+   */
+  forceinline
+  GqBoolWatch::Watch::Watch(Space& home, Propagator& p,
+                            Council<Watch>& c, int i0)
+    : Advisor(home,p,c), i(i0) {}
+  forceinline
+  GqBoolWatch::Watch::Watch(Space& home, bool share, Watch& a)
+    : Advisor(home,share,a), i(a.i) {}
+
+
+  /*
+   * Pseudo-Boolean inequality with watched literals
+   *
+   */
+  forceinline int
+  GqBoolWatch::coeff(int i) const {
+    return std::abs(a[i]);
+  }
+  forceinline bool
+  GqBoolWatch::one(int i) const {
+    return (a[i] > 0) ? x[i].one() : x[i].zero();
+  }
+  forceinline bool
+  GqBoolWatch::zero(int i) const {
+    return (a[i] > 0) ? x[i].zero() : x[i].one();
+  }
+
+  forceinline int
+  GqBoolWatch::amax(void) {
+    while ((m < x.size()) && x[m].assigned()) {
+      // Account for true literals that are not yet watched
+      if (!w[m] && one(m)) {
+        w[m] = true; ws += coeff(m); wt += coeff(m);
+      }
+      m++;
+    }
+    return (m < x.size()) ? coeff(m) : 0;
+  }
+
+  bool
+  GqBoolWatch::rewatch(Space& home, Watch* r, bool& u) {
+    u = false;
+    long long int l = c + amax();
+    for (int i=m; (ws < l) && (i < x.size()); i++)
+      if (!w[i] && !zero(i)) {
+        w[i] = true; ws += coeff(i);
+        if (!x[i].assigned()) {
+          if (r != NULL) {
+            r->i = i; x[i].subscribe(home,*r); r = NULL; u = true;
+          } else {
+            Watch* b = new (home) Watch(home,*this,co,i);
+            x[i].subscribe(home,*b);
+          }
+        } else {
+          wt += coeff(i);
+        }
+      }
+    return ws >= l;
+  }
+
+  forceinline
+  GqBoolWatch::GqBoolWatch(Home home, ViewArray<BoolView>& x0,
+                           SharedArray<int>& a0, long long int c0)
+    : Propagator(home), co(home), x(x0), a(a0), ws(0), wt(0), c(c0), m(0) {
+    home.notice(*this,AP_DISPOSE);
+    Space& s = home;
+    w = s.alloc<bool>(x.size());
+    for (int i=x.size(); i--; )
+      w[i] = false;
+    bool u;
+    if (!rewatch(s,NULL,u))
+      BoolView::schedule(s,*this,ME_BOOL_VAL);
+  }
+
+  forceinline
+  GqBoolWatch::GqBoolWatch(Space& home, bool share, GqBoolWatch& p)
+    : Propagator(home,share,p), ws(p.ws), wt(p.wt), c(p.c), m(p.m) {
+    co.update(home,share,p.co);
+    x.update(home,share,p.x);
+    a.update(home,share,p.a);
+    w = home.alloc<bool>(x.size());
+    for (int i=x.size(); i--; )
+      w[i] = p.w[i];
+  }
+
+  Actor*
+  GqBoolWatch::copy(Space& home, bool share) {
+    return new (home) GqBoolWatch(home,share,*this);
+  }
+
+  PropCost
+  GqBoolWatch::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO,x.size());
+  }
+
+  void
+  GqBoolWatch::reschedule(Space& home) {
+    if (ws < c + amax())
+      BoolView::schedule(home,*this,ME_BOOL_VAL);
+  }
+
+  ExecStatus
+  GqBoolWatch::advise(Space& home, Advisor& _a, const Delta&) {
+    Watch& b = static_cast<Watch&>(_a);
+    // A literal that became true remains watched
+    if (!zero(b.i)) {
+      wt += coeff(b.i);
+      // The propagator must run to be subsumed
+      return (wt >= c) ? ES_NOFIX : ES_FIX;
+    }
+    w[b.i] = false; ws -= coeff(b.i);
+    bool u;
+    if (rewatch(home,&b,u) && (wt < c))
+      return u ? ES_FIX : home.ES_FIX_DISPOSE(co,b);
+    else
+      return u ? ES_NOFIX : home.ES_NOFIX_DISPOSE(co,b);
+  }
+
+  ExecStatus
+  GqBoolWatch::propagate(Space& home, const ModEventDelta&) {
+    // Slack with respect to the literals that are not false
+    long long int s = -c;
+    // Sum of coefficients of true literals minus right-hand side
+    long long int t = -c;
+    for (int i=x.size(); i--; )
+      if (!zero(i)) {
+        s += coeff(i);
+        if (x[i].assigned())
+          t += coeff(i);
+      }
+    if (s < 0)
+      return ES_FAILED;
+    // All literals with a coefficient larger than the slack must be true
+    for (int i=m; (i < x.size()) && (coeff(i) > s); i++)
+      if (!x[i].assigned()) {
+        if (a[i] > 0) {
+          GECODE_ME_CHECK(x[i].one_none(home));
+        } else {
+          GECODE_ME_CHECK(x[i].zero_none(home));
+        }
+        t += coeff(i);
+      }
+    if (t >= 0)
+      return home.ES_SUBSUMED(*this);
+    bool u;
+    bool ok = rewatch(home,NULL,u);
+    assert(ok); (void) ok;
+    return ES_FIX;
+  }
+
+  size_t
+  GqBoolWatch::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    for (Advisors<Watch> as(co); as(); ++as)
+      x[as.advisor().i].cancel(home,as.advisor());
+    co.dispose(home);
+    a.~SharedArray();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  ExecStatus
+  GqBoolWatch::post(Home home, ViewArray<BoolView>& x,
+                    SharedArray<int>& a, long long int c) {
+    // Sums of coefficients of true literals and of non-false literals
+    long long int t = 0, s = 0;
+    for (int i=x.size(); i--; )
+      if ((a[i] > 0) ? x[i].one() : x[i].zero()) {
+        t += std::abs(a[i]); s += std::abs(a[i]);
+      } else if (!x[i].assigned()) {
+        s += std::abs(a[i]);
+      }
+    if (s < c)
+      return ES_FAILED;
+    if (t >= c)
+      return ES_OK;
+    (void) new (home) GqBoolWatch(home,x,a,c);
+    return ES_OK;
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -0,0 +1,344 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Linear {
+
+  /*
+   * Advisors for terms
+   *
+   */
+  template<class Val, class View>
+  forceinline
+  IncLin<Val,View>::Term::Term(Space& home, Propagator& p,
+                               BatchCouncil<Term>& c, View x, bool pos,
+                               int i0)
+    : BatchViewAdvisor<View>(home,p,c,x), p(pos), i(i0) {}
+  template<class Val, class View>
+  forceinline
+  IncLin<Val,View>::Term::Term(Space& home, bool share, Term& a)
+    : BatchViewAdvisor<View>(home,share,a), p(a.p), i(a.i) {}
+  template<class Val, class View>
+  forceinline Val
+  IncLin<Val,View>::Term::min(void) const {
+    return p ? static_cast<Val>(this->x.min()) :
+      -static_cast<Val>(this->x.max());
+  }
+  template<class Val, class View>
+  forceinline Val
+  IncLin<Val,View>::Term::max(void) const {
+    return p ? static_cast<Val>(this->x.max()) :
+      -static_cast<Val>(this->x.min());
+  }
+
+
+  /*
+   * Base-class for incremental linear propagators
+   *
+   */
+  template<class Val, class View>
+  forceinline
+  IncLin<Val,View>::IncLin(Home home,
+                           ViewArray<View>& x, ViewArray<View>& y, Val c)
+    : Propagator(home), co(home), n(x.size()+y.size()),
+      sl(c), su(-c) {
+    Space& s = home;
+    t = s.alloc<Term*>(n); l = s.alloc<Val>(n); u = s.alloc<Val>(n);
+    for (int i=0; i<x.size(); i++)
+      t[i] = new (home) Term(home,*this,co,x[i],true,i);
+    for (int i=0; i<y.size(); i++)
+      t[x.size()+i] = new (home) Term(home,*this,co,y[i],false,x.size()+i);
+    for (int i=0; i<n; i++) {
+      l[i] = t[i]->min(); u[i] = t[i]->max();
+      sl -= l[i]; su += u[i];
+    }
+    for (int i=n/2; i--; )
+      sift(i);
+    View::schedule(home,*this,ME_INT_BND);
+  }
+
+  template<class Val, class View>
+  forceinline
+  IncLin<Val,View>::IncLin(Space& home, bool share, IncLin<Val,View>& p)
+    : Propagator(home,share,p), n(0), sl(p.sl), su(p.su) {
+    co.update(home,share,p.co);
+    // Only keep the terms that are not assigned
+    for (Advisors<Term> as(co); as(); ++as)
+      n++;
+    t = home.alloc<Term*>(n);
+    l = home.alloc<Val>(n);
+    u = home.alloc<Val>(n);
+    int j=0;
+    for (Advisors<Term> as(co); as(); ++as) {
+      Term& a = as.advisor();
+      t[j] = &a; l[j] = p.l[a.i]; u[j] = p.u[a.i]; a.i = j++;
+    }
+    for (int i=n/2; i--; )
+      sift(i);
+  }
+
+  template<class Val, class View>
+  PropCost
+  IncLin<Val,View>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::unary(PropCost::HI);
+  }
+
+  template<class Val, class View>
+  void
+  IncLin<Val,View>::reschedule(Space& home) {
+    View::schedule(home,*this,ME_INT_BND);
+  }
+
+  template<class Val, class View>
+  forceinline size_t
+  IncLin<Val,View>::dispose(Space& home) {
+    co.dispose(home);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class Val, class View>
+  forceinline Val
+  IncLin<Val,View>::width(int i) const {
+    return u[i] - l[i];
+  }
+
+  template<class Val, class View>
+  forceinline void
+  IncLin<Val,View>::sift(int i) {
+    Term* ti = t[i];
+    Val li = l[i], ui = u[i];
+    while (2*i+1 < n) {
+      int j = 2*i+1;
+      if ((j+1 < n) && (width(j+1) > width(j)))
+        j++;
+      if (width(j) <= ui - li)
+        break;
+      t[i] = t[j]; l[i] = l[j]; u[i] = u[j];
+      if (t[i] != NULL)
+        t[i]->i = i;
+      i = j;
+    }
+    t[i] = ti; l[i] = li; u[i] = ui;
+    if (ti != NULL)
+      ti->i = i;
+  }
+
+  template<class Val, class View>
+  forceinline int
+  IncLin<Val,View>::wider(Val s, int* p) const {
+    /*
+     * The children of a term are not wider than the term: the terms
+     * wider than s form a subtree at the root and are found in
+     * increasing order of their positions.
+     */
+    int k = 0;
+    if ((n > 0) && (width(0) > s))
+      p[k++] = 0;
+    for (int j=0; j<k; j++)
+      for (int c=2*p[j]+1; (c < n) && (c <= 2*p[j]+2); c++)
+        if (width(c) > s)
+          p[k++] = c;
+    return k;
+  }
+
+  template<class Val, class View>
+  forceinline bool
+  IncLin<Val,View>::batch(Space& home) {
+    while (Term* a = co.pending()) {
+      int i = a->i;
+      Val li = a->min();
+      Val ui = a->max();
+      sl -= li - l[i]; su += ui - u[i];
+      l[i] = li; u[i] = ui;
+      if (li == ui) {
+        a->dispose(home,co); t[i] = NULL;
+      }
+      sift(i);
+    }
+    return co.empty();
+  }
+
+  template<class Val, class View>
+  forceinline ExecStatus
+  IncLin<Val,View>::lq(Space& home, int i, Val s) {
+    Term& a = *t[i];
+    if (a.p) {
+      GECODE_ME_CHECK(a.view().lq(home,s + l[i]));
+    } else {
+      GECODE_ME_CHECK(a.view().gq(home,-(s + l[i])));
+    }
+    Val ui = a.max();
+    su += ui - u[i]; u[i] = ui;
+    return ES_OK;
+  }
+
+  template<class Val, class View>
+  forceinline ExecStatus
+  IncLin<Val,View>::gq(Space& home, int i, Val s) {
+    Term& a = *t[i];
+    if (a.p) {
+      GECODE_ME_CHECK(a.view().gq(home,u[i] - s));
+    } else {
+      GECODE_ME_CHECK(a.view().lq(home,-(u[i] - s)));
+    }
+    Val li = a.min();
+    sl -= li - l[i]; l[i] = li;
+    return ES_OK;
+  }
+
+
+  /*
+   * Incremental bounds consistent linear equation
+   *
+   */
+  template<class Val, class View>
+  forceinline
+  IncEq<Val,View>::IncEq(Home home,
+                         ViewArray<View>& x, ViewArray<View>& y, Val c)
+    : IncLin<Val,View>(home,x,y,c) {}
+
+  template<class Val, class View>
+  ExecStatus
+  IncEq<Val,View>::post(Home home,
+                        ViewArray<View>& x, ViewArray<View>& y, Val c) {
+    (void) new (home) IncEq<Val,View>(home,x,y,c);
+    return ES_OK;
+  }
+
+  template<class Val, class View>
+  forceinline
+  IncEq<Val,View>::IncEq(Space& home, bool share, IncEq<Val,View>& p)
+    : IncLin<Val,View>(home,share,p) {}
+
+  template<class Val, class View>
+  Actor*
+  IncEq<Val,View>::copy(Space& home, bool share) {
+    return new (home) IncEq<Val,View>(home,share,*this);
+  }
+
+  template<class Val, class View>
+  ExecStatus
+  IncEq<Val,View>::propagate(Space& home, const ModEventDelta&) {
+    if (this->batch(home))
+      return (sl == 0) ? home.ES_SUBSUMED(*this) : ES_FAILED;
+    if ((sl < 0) || (su < 0))
+      return ES_FAILED;
+
+    // Only terms wider than the slack can be pruned
+    if (this->width(0) > std::min(sl,su)) {
+      Region r(home);
+      int* p = r.alloc<int>(n);
+      do {
+        Val s0 = sl, s1 = su;
+        int k = this->wider(std::min(sl,su),p);
+        for (int j=0; j<k; j++) {
+          int i = p[j];
+          if (this->width(i) > sl)
+            GECODE_ES_CHECK(this->lq(home,i,sl));
+          if (this->width(i) > su)
+            GECODE_ES_CHECK(this->gq(home,i,su));
+        }
+        // Restore the heap bottom-up
+        for (int j=k; j--; )
+          this->sift(p[j]);
+        if ((s0 == sl) && (s1 == su))
+          break;
+      } while (this->width(0) > std::min(sl,su));
+    }
+
+    return ((sl == 0) && (su == 0)) ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+
+  /*
+   * Incremental bounds consistent linear inequation
+   *
+   */
+  template<class Val, class View>
+  forceinline
+  IncLq<Val,View>::IncLq(Home home,
+                         ViewArray<View>& x, ViewArray<View>& y, Val c)
+    : IncLin<Val,View>(home,x,y,c) {}
+
+  template<class Val, class View>
+  ExecStatus
+  IncLq<Val,View>::post(Home home,
+                        ViewArray<View>& x, ViewArray<View>& y, Val c) {
+    (void) new (home) IncLq<Val,View>(home,x,y,c);
+    return ES_OK;
+  }
+
+  template<class Val, class View>
+  forceinline
+  IncLq<Val,View>::IncLq(Space& home, bool share, IncLq<Val,View>& p)
+    : IncLin<Val,View>(home,share,p) {}
+
+  template<class Val, class View>
+  Actor*
+  IncLq<Val,View>::copy(Space& home, bool share) {
+    return new (home) IncLq<Val,View>(home,share,*this);
+  }
+
+  template<class Val, class View>
+  ExecStatus
+  IncLq<Val,View>::propagate(Space& home, const ModEventDelta&) {
+    bool assigned = this->batch(home);
+    if (sl < 0)
+      return ES_FAILED;
+    if (assigned || (su <= 0))
+      return home.ES_SUBSUMED(*this);
+
+    // Only terms wider than the slack can be pruned
+    if (this->width(0) > sl) {
+      Region r(home);
+      int* p = r.alloc<int>(n);
+      int k = this->wider(sl,p);
+      for (int j=0; j<k; j++)
+        GECODE_ES_CHECK(this->lq(home,p[j],sl));
+      // Restore the heap bottom-up
+      for (int j=k; j--; )
+        this->sift(p[j]);
+    }
+
+    return (su <= 0) ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -161,6 +161,17 @@ namespace Gecode { namespace Int { namespace Linear {
   forceinline void
   post_nary(Home home,
             ViewArray<View>& x, ViewArray<View>& y, IntRelType irt, Val c) {
+    if (x.size() + y.size() >= inc_min_terms) {
+      switch (irt) {
+      case IRT_EQ:
+        GECODE_ES_FAIL((IncEq<Val,View>::post(home,x,y,c)));
+        return;
+      case IRT_LQ:
+        GECODE_ES_FAIL((IncLq<Val,View>::post(home,x,y,c)));
+        return;
+      default: break;
+      }
+    }
     switch (irt) {
     case IRT_EQ:
       GECODE_ES_FAIL((Eq<Val,View,View >::post(home,x,y,c)));
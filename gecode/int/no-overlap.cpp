@@ -55,7 +55,7 @@ namespace Gecode {
   nooverlap(Home home,
             const IntVarArgs& x, const IntArgs& w,
             const IntVarArgs& y, const IntArgs& h,
-            IntPropLevel) {
+            IntPropLevel ipl) {
     using namespace Int;
     using namespace NoOverlap;
     if ((x.size() != w.size()) || (x.size() != y.size()) ||
@@ -78,8 +78,13 @@ namespace Gecode {
       b[i][1] = FixDim(y[i],h[i]);
     }
 
-    GECODE_ES_FAIL((
-      NoOverlap::ManProp<ManBox<FixDim,2> >::post(home,b,x.size())));
+    if (vbd(ipl) == IPL_BND) {
+      GECODE_ES_FAIL((
+        NoOverlap::ManSweep<ManBox<FixDim,2> >::post(home,b,x.size())));
+    } else {
+      GECODE_ES_FAIL((
+        NoOverlap::ManProp<ManBox<FixDim,2> >::post(home,b,x.size())));
+    }
   }
 
   void
@@ -87,7 +92,7 @@ namespace Gecode {
             const IntVarArgs& x, const IntArgs& w,
             const IntVarArgs& y, const IntArgs& h,
             const BoolVarArgs& m,
-            IntPropLevel) {
+            IntPropLevel ipl) {
     using namespace Int;
     using namespace NoOverlap;
     if ((x.size() != w.size()) || (x.size() != y.size()) ||
@@ -111,8 +116,13 @@ namespace Gecode {
         b[i][1] = FixDim(y[i],h[i]);
         b[i].optional(m[i]);
       }
-      GECODE_ES_FAIL((
-        NoOverlap::OptProp<OptBox<FixDim,2> >::post(home,b,x.size())));
+      if (vbd(ipl) == IPL_BND) {
+        GECODE_ES_FAIL((
+          NoOverlap::OptSweep<OptBox<FixDim,2> >::post(home,b,x.size())));
+      } else {
+        GECODE_ES_FAIL((
+          NoOverlap::OptProp<OptBox<FixDim,2> >::post(home,b,x.size())));
+      }
     } else {
       ManBox<FixDim,2>* b
         = static_cast<Space&>(home).alloc<ManBox<FixDim,2> >(x.size());
@@ -123,7 +133,13 @@ namespace Gecode {
           b[n][1] = FixDim(y[i],h[i]);
           n++;
         }
-      GECODE_ES_FAIL((NoOverlap::ManProp<ManBox<FixDim,2> >::post(home,b,n)));
+      if (vbd(ipl) == IPL_BND) {
+        GECODE_ES_FAIL((
+          NoOverlap::ManSweep<ManBox<FixDim,2> >::post(home,b,n)));
+      } else {
+        GECODE_ES_FAIL((
+          NoOverlap::ManProp<ManBox<FixDim,2> >::post(home,b,n)));
+      }
     }
   }
 
@@ -131,7 +147,7 @@ namespace Gecode {
   nooverlap(Home home,
             const IntVarArgs& x0, const IntVarArgs& w, const IntVarArgs& x1,
             const IntVarArgs& y0, const IntVarArgs& h, const IntVarArgs& y1,
-            IntPropLevel) {
+            IntPropLevel ipl) {
     using namespace Int;
     using namespace NoOverlap;
     if ((x0.size() != w.size())  || (x0.size() != x1.size()) ||
@@ -151,7 +167,7 @@ namespace Gecode {
         wc[i] = w[i].val();
         hc[i] = h[i].val();
       }
-      nooverlap(home, x0, wc, y0, hc);
+      nooverlap(home, x0, wc, y0, hc, ipl);
     } else {
       ManBox<FlexDim,2>* b
         = static_cast<Space&>(home).alloc<ManBox<FlexDim,2> >(x0.size());
@@ -169,7 +185,7 @@ namespace Gecode {
             const IntVarArgs& x0, const IntVarArgs& w, const IntVarArgs& x1,
             const IntVarArgs& y0, const IntVarArgs& h, const IntVarArgs& y1,
             const BoolVarArgs& m,
-            IntPropLevel) {
+            IntPropLevel ipl) {
     using namespace Int;
     using namespace NoOverlap;
     if ((x0.size() != w.size())  || (x0.size() != x1.size()) ||
@@ -189,7 +205,7 @@ namespace Gecode {
         wc[i] = w[i].val();
         hc[i] = h[i].val();
       }
-      nooverlap(home, x0, wc, y0, hc, m);
+      nooverlap(home, x0, wc, y0, hc, m, ipl);
     } else if (optional(m)) {
       OptBox<FlexDim,2>* b
         = static_cast<Space&>(home).alloc<OptBox<FlexDim,2> >(x0.size());
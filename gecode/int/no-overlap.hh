@@ -76,7 +76,11 @@ namespace Gecode { namespace Int { namespace NoOverlap {
     int sec(void) const;
     /// Return largest end coordinate
     int lec(void) const;
+    /// Return size
+    int size(void) const;
 
+    /// Restrict start coordinate to \a n ... \a m
+    ExecStatus start(Space& home, int n, int m);
     /// Dimension must not overlap with \a d
     ExecStatus nooverlap(Space& home, FixDim& d);
 
@@ -316,11 +320,84 @@ namespace Gecode { namespace Int { namespace NoOverlap {
     virtual size_t dispose(Space& home);
   };
 
+  /**
+   * \brief Perform sweep for two-dimensional boxes with fixed sizes
+   *
+   * The boxes \a b[0] ... \a b[n-1] must be mandatory, the boxes
+   * \a b[n] ... \a b[n+m-1] optional. The start coordinates of the
+   * mandatory boxes are pruned and optional boxes that cannot be
+   * placed are excluded.
+   */
+  template<class Box>
+  ExecStatus sweep(Space& home, Box* b, int n, int m);
+
+  /**
+   * \brief Sweep-based no-overlap propagator for mandatory boxes
+   *
+   * Uses the sweep algorithm with forbidden regions from:
+   * N. Beldiceanu, M. Carlsson, Sweep as a generic pruning technique
+   * applied to the non-overlapping rectangles constraint, CP 2001.
+   * Requires two dimensions with fixed sizes.
+   *
+   * Requires \code #include <gecode/int/no-overlap.hh> \endcode
+   *
+   * \ingroup FuncIntProp
+   */
+  template<class Box>
+  class ManSweep : public Base<Box> {
+  protected:
+    using Base<Box>::b;
+    using Base<Box>::n;
+    /// Constructor for posting
+    ManSweep(Home home, Box* b, int n);
+    /// Constructor for cloning \a p
+    ManSweep(Space& home, bool share, ManSweep<Box>& p);
+  public:
+    /// Post propagator for boxes \a b
+    static ExecStatus post(Home home, Box* b, int n);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Destructor
+    virtual size_t dispose(Space& home);
+  };
+
+  /**
+   * \brief Sweep-based no-overlap propagator for optional boxes
+   *
+   * Requires \code #include <gecode/int/no-overlap.hh> \endcode
+   *
+   * \ingroup FuncIntProp
+   */
+  template<class Box>
+  class OptSweep : public Base<Box> {
+  protected:
+    using Base<Box>::b;
+    using Base<Box>::n;
+    /// Number of optional boxes: b[n] ... b[n+m-1]
+    int m;
+    /// Constructor for posting
+    OptSweep(Home home, Box* b, int n, int m);
+    /// Constructor for cloning \a p
+    OptSweep(Space& home, bool share, OptSweep<Box>& p);
+  public:
+    /// Post propagator for boxes \a b
+    static ExecStatus post(Home home, Box* b, int n);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Destructor
+    virtual size_t dispose(Space& home);
+  };
+
 }}}
 
 #include <gecode/int/no-overlap/base.hpp>
 #include <gecode/int/no-overlap/man.hpp>
 #include <gecode/int/no-overlap/opt.hpp>
+#include <gecode/int/no-overlap/sweep.hpp>
 
 #endif
 
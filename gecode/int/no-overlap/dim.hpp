@@ -64,6 +64,17 @@ namespace Gecode { namespace Int { namespace NoOverlap {
   FixDim::lec(void) const {
     return c.max() + s;
   }
+  forceinline int
+  FixDim::size(void) const {
+    return s;
+  }
+
+  forceinline ExecStatus
+  FixDim::start(Space& home, int n, int m) {
+    GECODE_ME_CHECK(c.gq(home, n));
+    GECODE_ME_CHECK(c.lq(home, m));
+    return ES_OK;
+  }
 
   forceinline ExecStatus
   FixDim::ssc(Space& home, int n) {
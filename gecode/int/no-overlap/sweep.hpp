@@ -0,0 +1,385 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace NoOverlap {
+
+  /// Forbidden region for the start coordinates of a box
+  class Forbidden {
+  public:
+    /// Largest forbidden coordinate in sweep dimension
+    int u0;
+    /// Smallest and largest forbidden coordinate in other dimension
+    int l1, u1;
+  };
+
+  /// Sort obstacles by increasing largest start coordinate
+  template<class Box>
+  class LscLess {
+  protected:
+    /// The boxes
+    const Box* b;
+    /// The dimension
+    int d;
+  public:
+    /// Initialize with boxes \a b0 and dimension \a d0
+    LscLess(const Box* b0, int d0) : b(b0), d(d0) {}
+    /// Return whether obstacle \a i can start before obstacle \a j
+    bool operator ()(int i, int j) {
+      return b[i][d].lsc() < b[j][d].lsc();
+    }
+  };
+
+  /// Sort obstacles by decreasing smallest end coordinate
+  template<class Box>
+  class SecGreater {
+  protected:
+    /// The boxes
+    const Box* b;
+    /// The dimension
+    int d;
+  public:
+    /// Initialize with boxes \a b0 and dimension \a d0
+    SecGreater(const Box* b0, int d0) : b(b0), d(d0) {}
+    /// Return whether obstacle \a i must end after obstacle \a j
+    bool operator ()(int i, int j) {
+      return b[i][d].sec() > b[j][d].sec();
+    }
+  };
+
+  /**
+   * \brief Sweep for the smallest feasible start coordinate of box \a b[i]
+   *
+   * The sweep is in dimension \a d between \a l and \a u. If \a up is
+   * false, all coordinates in dimension \a d are mirrored and the sweep
+   * finds the largest feasible start coordinate (negated).
+   *
+   * The forbidden regions are created from the obstacles \a o[j] ...
+   * \a o[k-1] which must be sorted such that the regions start in
+   * increasing order (by largest start coordinate if \a up, by
+   * decreasing smallest end coordinate otherwise). The regions are
+   * only created when the sweep line reaches them. The array \a a
+   * must provide space for \a k regions.
+   *
+   * Returns \a u+1 if there is no feasible coordinate.
+   */
+  template<class Box>
+  int
+  minstart(const Box* b, int i, int d, bool up,
+           const int* o, int j, int k, Forbidden* a, int l, int u) {
+    // The other dimension
+    int e = 1-d;
+    int sd = b[i][d].size(), se = b[i][e].size();
+    int l1 = b[i][e].ssc(), u1 = b[i][e].lsc();
+    // Active regions a[0] ... a[n-1], sorted by smallest coordinate
+    int n = 0;
+    int x = l;
+    while (x <= u) {
+      // Drop regions that end before the sweep line
+      {
+        int h = 0;
+        for (int g=0; g<n; g++)
+          if (a[g].u0 >= x)
+            a[h++] = a[g];
+        n = h;
+      }
+      // Add regions that start at or before the sweep line
+      for ( ; j<k; j++) {
+        int c = o[j];
+        long long fl0 = static_cast<long long>(b[c][d].lsc()) - sd + 1;
+        long long fu0 = b[c][d].sec() - 1;
+        if (!up) {
+          long long t = fl0; fl0 = -fu0; fu0 = -t;
+        }
+        if (fl0 > x)
+          break;
+        if ((c == i) || (fu0 < x))
+          continue;
+        Forbidden f;
+        f.u0 = static_cast<int>(std::min(fu0,static_cast<long long>(u)));
+        f.l1 = static_cast<int>
+          (std::max(static_cast<long long>(b[c][e].lsc()) - se + 1,
+                    static_cast<long long>(l1)));
+        f.u1 = std::min(b[c][e].sec() - 1, u1);
+        if (f.l1 > f.u1)
+          continue;
+        int h = n++;
+        while ((h > 0) && (a[h-1].l1 > f.l1)) {
+          a[h] = a[h-1]; h--;
+        }
+        a[h] = f;
+      }
+      // Find smallest uncovered coordinate in other dimension
+      int y = l1;
+      for (int g=0; (g<n) && (a[g].l1 <= y); g++)
+        y = std::max(y, a[g].u1+1);
+      if (y <= u1)
+        return x;
+      // Everything is covered, move to where the first active region ends
+      assert(n > 0);
+      x = a[0].u0+1;
+      for (int g=1; g<n; g++)
+        x = std::min(x, a[g].u0+1);
+    }
+    return x;
+  }
+
+  template<class Box>
+  ExecStatus
+  sweep(Space& home, Box* b, int n, int m) {
+    assert(Box::dim() == 2);
+    Region r(home);
+
+    // Largest size of any box per dimension
+    int s[2] = {0, 0};
+    for (int i=n+m; i--; )
+      for (int d=0; d<2; d++)
+        s[d] = std::max(s[d], b[i][d].size());
+
+    /*
+     * A mandatory box is an obstacle if it can create a non-empty
+     * forbidden region for some box: for each dimension its compulsory
+     * part from lsc() to sec() enlarged by the size of a box must
+     * contain at least one coordinate.
+     */
+    int* ol = r.alloc<int>(n);
+    int k = 0;
+    for (int i=0; i<n; i++)
+      if ((b[i][0].sec() - b[i][0].lsc() + s[0] >= 2) &&
+          (b[i][1].sec() - b[i][1].lsc() + s[1] >= 2))
+        ol[k++] = i;
+    if (k == 0)
+      return ES_OK;
+
+    // Obstacles sorted by decreasing smallest end coordinate
+    int* oe = r.alloc<int>(k);
+    // Largest start and smallest end coordinates when sorted
+    int* lsc = r.alloc<int>(k);
+    int* sec = r.alloc<int>(k);
+    // Active forbidden regions
+    Forbidden* a = r.alloc<Forbidden>(k);
+
+    for (int d=0; d<2; d++) {
+      LscLess<Box> ll(b,d);
+      Support::quicksort<int,LscLess<Box> >(ol,k,ll);
+      for (int j=0; j<k; j++)
+        oe[j] = ol[j];
+      SecGreater<Box> sg(b,d);
+      Support::quicksort<int,SecGreater<Box> >(oe,k,sg);
+
+      // Largest compulsory part
+      int cp = b[ol[0]][d].sec() - b[ol[0]][d].lsc();
+      for (int j=0; j<k; j++) {
+        lsc[j] = b[ol[j]][d].lsc();
+        sec[j] = b[oe[j]][d].sec();
+        cp = std::max(cp, b[ol[j]][d].sec() - lsc[j]);
+      }
+
+      for (int i=0; i<n+m; i++) {
+        if (b[i].excluded())
+          continue;
+        int l = b[i][d].ssc(), u = b[i][d].lsc();
+        int sd = b[i][d].size();
+
+        // Skip obstacles that end before l (lsc < l+1-cp)
+        int jl;
+        {
+          long long v = static_cast<long long>(l) + 1 - cp;
+          int lo = 0, hi = k;
+          while (lo < hi) {
+            int mi = lo + (hi - lo) / 2;
+            if (lsc[mi] < v) lo = mi+1; else hi = mi;
+          }
+          jl = lo;
+        }
+        int sl = minstart(b,i,d,true,ol,jl,k,a,l,u);
+        if (sl > u) {
+          if (b[i].mandatory())
+            return ES_FAILED;
+          GECODE_ES_CHECK(b[i].exclude(home));
+        } else if (b[i].mandatory()) {
+          // Skip obstacles that start after u (sec > u+sd-1+cp)
+          int je;
+          {
+            long long v = static_cast<long long>(u) + sd - 1 + cp;
+            int lo = 0, hi = k;
+            while (lo < hi) {
+              int mi = lo + (hi - lo) / 2;
+              if (sec[mi] > v) lo = mi+1; else hi = mi;
+            }
+            je = lo;
+          }
+          int su = -minstart(b,i,d,false,oe,je,k,a,-u,-sl);
+          GECODE_ES_CHECK(b[i][d].start(home,sl,su));
+        }
+      }
+    }
+    return ES_OK;
+  }
+
+  /// Check whether all boxes \a b[0] ... \a b[n-1] are assigned
+  template<class Box>
+  forceinline bool
+  assigned(const Box* b, int n) {
+    for (int i=n; i--; )
+      for (int d=0; d<Box::dim(); d++)
+        if (b[i][d].ssc() != b[i][d].lsc())
+          return false;
+    return true;
+  }
+
+
+  /*
+   * Mandatory boxes
+   *
+   */
+  template<class Box>
+  forceinline
+  ManSweep<Box>::ManSweep(Home home, Box* b, int n)
+    : Base<Box>(home, b, n) {}
+
+  template<class Box>
+  inline ExecStatus
+  ManSweep<Box>::post(Home home, Box* b, int n) {
+    if (n > 1)
+      (void) new (home) ManSweep<Box>(home,b,n);
+    return ES_OK;
+  }
+
+  template<class Box>
+  forceinline size_t
+  ManSweep<Box>::dispose(Space& home) {
+    (void) Base<Box>::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class Box>
+  forceinline
+  ManSweep<Box>::ManSweep(Space& home, bool shared, ManSweep<Box>& p)
+    : Base<Box>(home, shared, p, p.n) {}
+
+  template<class Box>
+  Actor*
+  ManSweep<Box>::copy(Space& home, bool share) {
+    return new (home) ManSweep<Box>(home,share,*this);
+  }
+
+  template<class Box>
+  ExecStatus
+  ManSweep<Box>::propagate(Space& home, const ModEventDelta&) {
+    // If all boxes are assigned, the sweep only checks
+    bool a = assigned(b,n);
+    GECODE_ES_CHECK(sweep(home,b,n,0));
+    return a ? home.ES_SUBSUMED(*this) : ES_NOFIX;
+  }
+
+
+  /*
+   * Optional boxes
+   *
+   */
+  template<class Box>
+  forceinline
+  OptSweep<Box>::OptSweep(Home home, Box* b, int n, int m0)
+    : Base<Box>(home,b,n), m(m0) {
+    for (int i=m; i--; )
+      b[n+i].subscribe(home, *this);
+  }
+
+  template<class Box>
+  ExecStatus
+  OptSweep<Box>::post(Home home, Box* b, int n) {
+    // Partition into mandatory and optional boxes
+    if (n > 1) {
+      int p = Base<Box>::partition(b, 0, n);
+      (void) new (home) OptSweep<Box>(home,b,p,n-p);
+    }
+    return ES_OK;
+  }
+
+  template<class Box>
+  forceinline size_t
+  OptSweep<Box>::dispose(Space& home) {
+    for (int i=m; i--; )
+      b[n+i].cancel(home, *this);
+    (void) Base<Box>::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class Box>
+  forceinline
+  OptSweep<Box>::OptSweep(Space& home, bool shared, OptSweep<Box>& p)
+    : Base<Box>(home, shared, p, p.n + p.m), m(p.m) {}
+
+  template<class Box>
+  Actor*
+  OptSweep<Box>::copy(Space& home, bool share) {
+    return new (home) OptSweep<Box>(home,share,*this);
+  }
+
+  template<class Box>
+  ExecStatus
+  OptSweep<Box>::propagate(Space& home, const ModEventDelta& med) {
+    if (BoolView::me(med) == ME_BOOL_VAL) {
+      // Eliminate excluded boxes
+      for (int i=m; i--; )
+        if (b[n+i].excluded()) {
+          b[n+i].cancel(home,*this);
+          b[n+i] = b[n+(--m)];
+        }
+      // Reconsider optional boxes
+      if (m > 0) {
+        int p = Base<Box>::partition(b+n, 0, m);
+        n += p; m -= p;
+      }
+    }
+
+    bool a = assigned(b,n);
+    GECODE_ES_CHECK(sweep(home,b,n,m));
+
+    // Eliminate boxes that have been excluded by the sweep
+    for (int i=m; i--; )
+      if (b[n+i].excluded()) {
+        b[n+i].cancel(home,*this);
+        b[n+i] = b[n+(--m)];
+      }
+
+    return (a && (m == 0)) ? home.ES_SUBSUMED(*this) : ES_NOFIX;
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -304,17 +304,17 @@ namespace Gecode { namespace Int { namespace NValues {
     static const int VS_ONE  = 1 << 1;
     /// Status information about the views
     int status;
-    /// The advisor council
-    Council<ViewAdvisor<BoolView> > c;
+    /// The advisor council (modifications are batched)
+    BatchCouncil<BatchViewAdvisor<BoolView> > c;
     /// The view for counting the number of values
     VY y;
     /// Constructor for posting
     BoolBase(Home home, int status, ViewArray<BoolView>& x, VY y);
     /// Constructor for cloning \a p
     BoolBase(Space& home, bool share, BoolBase<VY>& p);
+    /// Update status for all views that have been assigned
+    void batch(Space& home);
   public:
-    /// Give advice to propagator
-    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
     /// Cost function (defined as low unary)
     virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
     /// Schedule function
@@ -337,6 +337,7 @@ namespace Gecode { namespace Int { namespace NValues {
     using BoolBase<VY>::status;
     using BoolBase<VY>::c;
     using BoolBase<VY>::y;
+    using BoolBase<VY>::batch;
     /// Constructor for posting
     EqBool(Home home, int status, ViewArray<BoolView>& x, VY y);
     /// Constructor for cloning \a p
@@ -369,6 +370,7 @@ namespace Gecode { namespace Int { namespace NValues {
     using BoolBase<VY>::status;
     using BoolBase<VY>::c;
     using BoolBase<VY>::y;
+    using BoolBase<VY>::batch;
     /// Constructor for posting
     LqBool(Home home, int status, ViewArray<BoolView>& x, VY y);
     /// Constructor for cloning \a p
@@ -401,6 +403,7 @@ namespace Gecode { namespace Int { namespace NValues {
     using BoolBase<VY>::status;
     using BoolBase<VY>::c;
     using BoolBase<VY>::y;
+    using BoolBase<VY>::batch;
     /// Constructor for posting
     GqBool(Home home, int status, ViewArray<BoolView>& x, VY y);
     /// Constructor for cloning \a p
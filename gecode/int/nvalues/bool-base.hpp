@@ -45,7 +45,7 @@ namespace Gecode { namespace Int { namespace NValues {
     y.subscribe(home,*this,PC_INT_BND);
     for (int i=x.size(); i--; ) {
       assert(!x[i].assigned());
-      (void) new (home) ViewAdvisor<BoolView>(home, *this, c, x[i]);
+      (void) new (home) BatchViewAdvisor<BoolView>(home, *this, c, x[i]);
     }
   }
 
@@ -70,24 +70,15 @@ namespace Gecode { namespace Int { namespace NValues {
   }
 
   template<class VY>
-  ExecStatus
-  BoolBase<VY>::advise(Space& home, Advisor& _a, const Delta&) {
-    ViewAdvisor<BoolView>& a(static_cast<ViewAdvisor<BoolView>&>(_a));
-    ExecStatus es;
-    if (status == (VS_ZERO | VS_ONE)) {
-      // Everything is already decided
-      es = ES_FIX;
-    } else {
-      if (a.view().zero())
+  forceinline void
+  BoolBase<VY>::batch(Space& home) {
+    while (BatchViewAdvisor<BoolView>* a = c.pending()) {
+      if (a->view().zero())
         status |= VS_ZERO;
       else
         status |= VS_ONE;
-      es = ES_NOFIX;
+      a->dispose(home,c);
     }
-    a.dispose(home,c);
-    if (c.empty())
-      es = ES_NOFIX;
-    return es;
   }
 
   template<class VY>
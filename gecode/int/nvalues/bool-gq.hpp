@@ -111,6 +111,7 @@ namespace Gecode { namespace Int { namespace NValues {
   template<class VY>
   ExecStatus
   GqBool<VY>::propagate(Space& home, const ModEventDelta&) {
+    batch(home);
     if (status == (VS_ZERO | VS_ONE))
       return home.ES_SUBSUMED(*this);
 
@@ -124,9 +125,9 @@ namespace Gecode { namespace Int { namespace NValues {
       return home.ES_SUBSUMED(*this);
 
     if (y.min() == 2) {
-      Advisors<ViewAdvisor<BoolView> > as(c);
+      Advisors<BatchViewAdvisor<BoolView> > as(c);
       assert(as());
-      ViewAdvisor<BoolView>& a(as.advisor());
+      BatchViewAdvisor<BoolView>& a(as.advisor());
       ++as;
       if (!as()) {
         // Only a single view is left
@@ -113,6 +113,7 @@ namespace Gecode { namespace Int { namespace NValues {
   template<class VY>
   ExecStatus
   LqBool<VY>::propagate(Space& home, const ModEventDelta&) {
+    batch(home);
     if (status == (VS_ZERO | VS_ONE)) {
       GECODE_ME_CHECK(y.gq(home,2));
       return home.ES_SUBSUMED(*this);
@@ -127,14 +128,14 @@ namespace Gecode { namespace Int { namespace NValues {
       if (status == VS_ZERO) {
         // Mark that everything is done
         status = VS_ZERO | VS_ONE;
-        for (Advisors<ViewAdvisor<BoolView> > as(c); as(); ++as)
+        for (Advisors<BatchViewAdvisor<BoolView> > as(c); as(); ++as)
           GECODE_ME_CHECK(as.advisor().view().zero(home));
         return home.ES_SUBSUMED(*this);
       }
       if (status == VS_ONE) {
         // Mark that everything is done
         status = VS_ZERO | VS_ONE;
-        for (Advisors<ViewAdvisor<BoolView> > as(c); as(); ++as)
+        for (Advisors<BatchViewAdvisor<BoolView> > as(c); as(); ++as)
           GECODE_ME_CHECK(as.advisor().view().one(home));
         return home.ES_SUBSUMED(*this);
       }
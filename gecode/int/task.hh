@@ -457,6 +457,10 @@ namespace Gecode { namespace Int {
     static const bool basic = true;
     /// Do not perform advanced propagation
     static const bool advanced = false;
+    /// Do not perform time-table edge-finding
+    static const bool ttef = false;
+    /// Do not perform energetic reasoning
+    static const bool energetic = false;
     /// For basic propagation, domain operations are needed
     static const PropCond pc = PC_INT_DOM;
   };
@@ -468,6 +472,10 @@ namespace Gecode { namespace Int {
     static const bool basic = false;
     /// Do not perform advanced propagation
     static const bool advanced = true;
+    /// Do not perform time-table edge-finding
+    static const bool ttef = false;
+    /// Do not perform energetic reasoning
+    static const bool energetic = false;
     /// For basic propagation, domain operations are needed
     static const PropCond pc = PC_INT_BND;
   };
@@ -479,6 +487,40 @@ namespace Gecode { namespace Int {
     static const bool basic = true;
     /// Do not perform advanced propagation
     static const bool advanced = true;
+    /// Do not perform time-table edge-finding
+    static const bool ttef = false;
+    /// Do not perform energetic reasoning
+    static const bool energetic = false;
+    /// For basic propagation, domain operations are needed
+    static const PropCond pc = PC_INT_DOM;
+  };
+
+  /// Class for defining basic and time-table edge-finding propagation level
+  class PLBT {
+  public:
+    /// Perform basic propagation
+    static const bool basic = true;
+    /// Do not perform advanced propagation
+    static const bool advanced = false;
+    /// Perform time-table edge-finding
+    static const bool ttef = true;
+    /// Do not perform energetic reasoning
+    static const bool energetic = false;
+    /// For basic propagation, domain operations are needed
+    static const PropCond pc = PC_INT_DOM;
+  };
+
+  /// Class for defining basic and energetic reasoning propagation level
+  class PLBE {
+  public:
+    /// Perform basic propagation
+    static const bool basic = true;
+    /// Do not perform advanced propagation
+    static const bool advanced = false;
+    /// Do not perform time-table edge-finding
+    static const bool ttef = false;
+    /// Perform energetic reasoning
+    static const bool energetic = true;
     /// For basic propagation, domain operations are needed
     static const PropCond pc = PC_INT_DOM;
   };
@@ -535,6 +577,85 @@ namespace Gecode { namespace Int {
 
 #include <gecode/int/task/event.hpp>
 
+namespace Gecode { namespace Int {
+
+  /**
+   * \brief Resource profile cached between time-tabling runs
+   *
+   * A complete time-tabling run sweeps over the sorted events of all
+   * tasks and records the resulting profile of compulsory parts. As
+   * compulsory parts only grow and tasks only change from optional to
+   * mandatory or excluded, a signature of the tasks suffices to detect
+   * whether the profile is still valid for a later run. If it is, only
+   * the time windows of the tasks must be checked against the cached
+   * profile and no events must be created and sorted.
+   */
+  class ResourceProfile {
+  public:
+    /// Signature of tasks for which the profile has been computed
+    class Signature {
+    public:
+      /// Number of tasks
+      int n;
+      /// Capacity of resource
+      int cap;
+      /// Number of mandatory and excluded tasks
+      int nm, ne;
+      /// Number of zero-length tasks
+      int nz;
+      /// Number of compulsory parts of mandatory and optional tasks
+      int pm, po;
+      /// Area of compulsory parts of mandatory and optional tasks
+      long long int am, ao;
+      /// Sum of time windows and processing times of unassigned mandatory tasks
+      long long int w;
+      /// Initialize for \a n tasks and capacity \a cap
+      void init(int n, int cap);
+      /// Add task \a t with required capacity \a c
+      template<class Task>
+      void add(const Task& t, int c);
+      /// Test whether the compulsory parts are the same as for \a s
+      bool same(const Signature& s) const;
+      /// Test whether also the time windows are the same as for \a s
+      bool equal(const Signature& s) const;
+    };
+  protected:
+    /// Signature of the tasks the profile has been computed for
+    Signature s;
+    /// Whether the profile has been computed at all
+    bool valid;
+    /// Number of segments and number of segments that can be stored
+    int m, cm;
+    /// Start times of segments
+    int* st;
+    /// Free capacity of segments
+    int* fc;
+    /// Minimal free capacity of all segments
+    int mfc;
+  public:
+    /// Initialize as invalid
+    ResourceProfile(void);
+    /// Update during cloning
+    void update(Space& home, const ResourceProfile& p);
+    /// Test whether the profile is still valid for signature \a s
+    bool unchanged(const Signature& s) const;
+    /// Test whether the time windows are still the same as for \a s
+    bool same(const Signature& s) const;
+    /// Record that the time windows are the ones from \a s
+    void window(const Signature& s);
+    /// Start new profile for signature \a s with at most \a n segments
+    void init(Space& home, const Signature& s, int n);
+    /// Add segment starting at time \a t with free capacity \a f
+    void segment(int t, int f);
+    /// Check task \a t with required capacity \a c against profile
+    template<class Task>
+    ExecStatus check(Space& home, Task& t, int c) const;
+  };
+
+}}
+
+#include <gecode/int/task/profile.hpp>
+
 #endif
 
 // STATISTICS: int-prop
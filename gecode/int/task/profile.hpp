@@ -0,0 +1,175 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int {
+
+  /*
+   * Signature of tasks
+   *
+   */
+  forceinline void
+  ResourceProfile::Signature::init(int n0, int cap0) {
+    n=n0; cap=cap0;
+    nm=ne=nz=pm=po=0;
+    am=ao=w=0;
+  }
+
+  template<class Task>
+  forceinline void
+  ResourceProfile::Signature::add(const Task& t, int c) {
+    if (t.excluded()) {
+      ne++; return;
+    }
+    bool man = t.mandatory();
+    if (man)
+      nm++;
+    bool part;
+    if (t.assigned()) {
+      part = (t.pmin() > 0);
+      if (t.pmax() == 0)
+        nz++;
+    } else {
+      if (man)
+        w += static_cast<long long int>(t.est()) - t.lct() + t.pmin();
+      part = (t.lst() < t.ect());
+    }
+    if (part) {
+      long long int a = static_cast<long long int>(c) * (t.ect() - t.lst());
+      if (man) {
+        pm++; am += a;
+      } else {
+        po++; ao += a;
+      }
+    }
+  }
+
+  forceinline bool
+  ResourceProfile::Signature::same(const Signature& s) const {
+    return ((n == s.n) && (cap == s.cap) && (nm == s.nm) && (ne == s.ne) &&
+            (nz == s.nz) && (pm == s.pm) && (po == s.po) &&
+            (am == s.am) && (ao == s.ao));
+  }
+
+  forceinline bool
+  ResourceProfile::Signature::equal(const Signature& s) const {
+    return same(s) && (w == s.w);
+  }
+
+
+  /*
+   * Resource profile
+   *
+   */
+  forceinline
+  ResourceProfile::ResourceProfile(void)
+    : valid(false), m(0), cm(0), st(NULL), fc(NULL), mfc(0) {}
+
+  forceinline void
+  ResourceProfile::update(Space& home, const ResourceProfile& p) {
+    s=p.s; valid=p.valid; m=p.m; cm=p.m; mfc=p.mfc;
+    if (m > 0) {
+      st=home.alloc<int>(m); fc=home.alloc<int>(m);
+      for (int i=m; i--; ) {
+        st[i]=p.st[i]; fc[i]=p.fc[i];
+      }
+    } else {
+      st=NULL; fc=NULL;
+    }
+  }
+
+  forceinline bool
+  ResourceProfile::unchanged(const Signature& s0) const {
+    return valid && s.same(s0);
+  }
+
+  forceinline bool
+  ResourceProfile::same(const Signature& s0) const {
+    return s.w == s0.w;
+  }
+
+  forceinline void
+  ResourceProfile::window(const Signature& s0) {
+    s.w = s0.w;
+  }
+
+  forceinline void
+  ResourceProfile::init(Space& home, const Signature& s0, int n) {
+    s=s0; valid=true; m=0; mfc=s.cap;
+    if (n > cm) {
+      st=home.realloc<int>(st,cm,n);
+      fc=home.realloc<int>(fc,cm,n);
+      cm=n;
+    }
+  }
+
+  forceinline void
+  ResourceProfile::segment(int t, int f) {
+    assert(m < cm);
+    st[m]=t; fc[m]=f; m++;
+    if (f < mfc)
+      mfc = f;
+  }
+
+  template<class Task>
+  forceinline ExecStatus
+  ResourceProfile::check(Space& home, Task& t, int c) const {
+    // Task fits everywhere
+    if (c <= mfc)
+      return ES_OK;
+    int est=t.est(), lct=t.lct(), lst=t.lst(), ect=t.ect();
+    // Find first segment that covers the earliest start time
+    int l=0, r=m;
+    while (l < r) {
+      int i = l + (r-l) / 2;
+      if (st[i] <= est)
+        l=i+1;
+      else
+        r=i;
+    }
+    // Segments before the first one have the entire capacity free
+    for (int i = (l > 0) ? l-1 : 0; (i < m) && (st[i] < lct); i++)
+      // Segments are split at the start and end of the compulsory part
+      if ((c > fc[i]) && ((lst >= ect) || (st[i] < lst) || (st[i] >= ect))) {
+        int e = (i+1 < m) ? st[i+1]-1 : Limits::infinity-1;
+        GECODE_ME_CHECK(t.norun(home,st[i],e));
+      }
+    return ES_OK;
+  }
+
+}}
+
+// STATISTICS: int-prop
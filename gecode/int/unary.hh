@@ -760,7 +760,8 @@ namespace Gecode { namespace Int { namespace Unary {
 
   /// Perform time-tabling propagation
   template<class Task>
-  ExecStatus timetabling(Space& home, Propagator& p, TaskArray<Task>& t);
+  ExecStatus timetabling(Space& home, Propagator& p, TaskArray<Task>& t,
+                         ResourceProfile& rp);
 
   /// Check tasks \a t for subsumption
   template<class Task>
@@ -795,6 +796,8 @@ namespace Gecode { namespace Int { namespace Unary {
   class ManProp : public TaskProp<ManTask,PL> {
   protected:
     using TaskProp<ManTask,PL>::t;
+    /// Profile cached for time-tabling
+    ResourceProfile rp;
     /// Constructor for creation
     ManProp(Home home, TaskArray<ManTask>& t);
     /// Constructor for cloning \a p
@@ -818,6 +821,8 @@ namespace Gecode { namespace Int { namespace Unary {
   class OptProp : public TaskProp<OptTask,PL> {
   protected:
     using TaskProp<OptTask,PL>::t;
+    /// Profile cached for time-tabling
+    ResourceProfile rp;
     /// Constructor for creation
     OptProp(Home home, TaskArray<OptTask>& t);
     /// Constructor for cloning \a p
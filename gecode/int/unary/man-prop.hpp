@@ -46,7 +46,9 @@ namespace Gecode { namespace Int { namespace Unary {
   forceinline
   ManProp<ManTask,PL>::ManProp(Space& home, bool shared,
                                       ManProp<ManTask,PL>& p)
-    : TaskProp<ManTask,PL>(home,shared,p) {}
+    : TaskProp<ManTask,PL>(home,shared,p) {
+    rp.update(home,p.rp);
+  }
 
   template<class ManTask, class PL>
   forceinline ExecStatus
@@ -68,7 +70,7 @@ namespace Gecode { namespace Int { namespace Unary {
     GECODE_ES_CHECK(overload(home,t));
 
     if (PL::basic)
-      GECODE_ES_CHECK(timetabling(home,*this,t));
+      GECODE_ES_CHECK(timetabling(home,*this,t,rp));
 
     if (PL::advanced) {
       GECODE_ES_CHECK(detectable(home,t));
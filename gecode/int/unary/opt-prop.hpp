@@ -48,7 +48,9 @@ namespace Gecode { namespace Int { namespace Unary {
   forceinline
   OptProp<OptTask,PL>::OptProp(Space& home, bool shared,
                                OptProp<OptTask,PL>& p)
-    : TaskProp<OptTask,PL>(home,shared,p) {}
+    : TaskProp<OptTask,PL>(home,shared,p) {
+    rp.update(home,p.rp);
+  }
 
   template<class OptTask, class PL>
   ExecStatus
@@ -87,7 +89,7 @@ namespace Gecode { namespace Int { namespace Unary {
     GECODE_ES_CHECK((overload<OptTask,PL>(home,*this,t)));
 
     if (PL::basic)
-      GECODE_ES_CHECK(timetabling(home,*this,t));
+      GECODE_ES_CHECK(timetabling(home,*this,t,rp));
 
     if (PL::advanced) {
       GECODE_ES_CHECK((detectable<OptTask,PL>(home,*this,t)));
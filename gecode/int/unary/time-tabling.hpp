@@ -41,7 +41,37 @@ namespace Gecode { namespace Int { namespace Unary {
 
   template<class Task>
   ExecStatus
-  timetabling(Space& home, Propagator& p, TaskArray<Task>& t) {
+  timetabling(Space& home, Propagator& p, TaskArray<Task>& t,
+              ResourceProfile& rp) {
+    ResourceProfile::Signature s;
+    s.init(t.size(),1);
+    for (int i=t.size(); i--; )
+      s.add(t[i],1);
+
+    if (rp.unchanged(s)) {
+      // Profile is still valid, only check the tasks' time windows
+      bool assigned = true;
+      if (rp.same(s)) {
+        for (int i=t.size(); i--; )
+          if (!t[i].assigned()) {
+            assigned = false; break;
+          }
+      } else {
+        rp.window(s);
+        for (int i=t.size(); i--; )
+          if (!t[i].assigned()) {
+            assigned = false;
+            if (t[i].mandatory())
+              GECODE_ES_CHECK(rp.check(home,t[i],1));
+          }
+      }
+      if (assigned)
+        return home.ES_SUBSUMED(p);
+      return ES_NOFIX;
+    }
+
+    rp.init(home,s,4*t.size()+1);
+
     Region r(home);
 
     bool assigned;
@@ -90,6 +120,9 @@ namespace Gecode { namespace Int { namespace Unary {
             GECODE_ME_CHECK(t[e->idx()].excluded(home));
           }
 
+        // Record whether resource is free until next time
+        rp.segment(time,free ? 1 : 0);
+
         if (!free)
           for (Iter::Values::BitSet<Support::BitSet<Region> > j(tasks);
                j(); ++j)
@@ -86,12 +86,44 @@ namespace Gecode { namespace Int {
   /**
    * \brief Integer variable implementation
    *
+   * A domain is represented in one of three ways:
+   *  - A domain without holes is represented by its minimum and
+   *    maximum only.
+   *  - A domain with holes whose width does not exceed the number of
+   *    bits in a word (IntVarImp::bs_max) is represented by a bitset
+   *    stored in a single word, where bit \f$i\f$ is set if and only if
+   *    the minimum plus \f$i\f$ is included in the domain.
+   *  - All other domains are represented by a list of ranges.
+   *
+   * Holes in small domains are always represented by a bitset. A
+   * range list whose width has become small enough is turned into a
+   * bitset by the next operation that prunes by an iterator or when
+   * the variable implementation is copied.
+   *
    * \ingroup Other
    */
   class IntVarImp : public IntVarImpBase {
     friend class IntVarImpFwd;
     friend class IntVarImpBwd;
   protected:
+#ifdef GECODE_SUPPORT_MSVC_64
+    /// Word for bitset representation
+    typedef unsigned __int64 Bits;
+#else
+    /// Word for bitset representation
+    typedef unsigned long int Bits;
+#endif
+    /// Maximal width of a domain with bitset representation
+    static const unsigned int bs_max =
+      static_cast<unsigned int>(CHAR_BIT * sizeof(Bits));
+    /// Return word with bits \a l to \a h set
+    static Bits bs_mask(unsigned int l, unsigned int h);
+    /// Return position of least significant bit set in \a w
+    static unsigned int bs_lsb(Bits w);
+    /// Return position of most significant bit set in \a w
+    static unsigned int bs_msb(Bits w);
+    /// Return number of bits set in \a w
+    static unsigned int bs_cnt(Bits w);
     /**
      * \brief Lists of ranges (intervals)
      *
@@ -188,8 +220,12 @@ namespace Gecode { namespace Int {
      * of a RangeList defining the domain.
      */
     RangeList dom;
-    /// Link the last element
-    RangeList* _lst;
+    union {
+      /// Link the last element (range list representation)
+      RangeList* _lst;
+      /// Values relative to the minimum (bitset representation)
+      Bits _bs;
+    };
     /// Return first element of rangelist
     RangeList* fst(void) const;
     /// Set first element of rangelist
@@ -200,6 +236,19 @@ namespace Gecode { namespace Int {
     void lst(RangeList* l);
     /// Size of holes in the domain
     unsigned int holes;
+    /// Whether domain is represented by a bitset
+    bool bitset(void) const;
+    /// Return bitset for domain (also for domains without holes)
+    Bits bs(void) const;
+    /// Set bitset for domain to \a w
+    void bs(Bits w);
+    /**
+     * \brief Narrow domain to values \a m plus positions of bits in \a w
+     *
+     * The values must be a subset of the current domain and the width
+     * of the current domain must not exceed IntVarImp::bs_max.
+     */
+    GECODE_INT_EXPORT ModEvent bs_narrow(Space& home, int m, Bits w);
 
   protected:
     /// Constructor for cloning \a x
@@ -249,15 +298,6 @@ namespace Gecode { namespace Int {
     bool in(long long int n) const;
     //@}
 
-  protected:
-    /// \name Range list access for iteration
-    //@{
-    /// Return range list for forward iteration
-    const RangeList* ranges_fwd(void) const;
-    /// Return range list for backward iteration
-    const RangeList* ranges_bwd(void) const;
-    //@}
-
   private:
     /// Test whether \a n is closer to the minimum or maximum
     bool closer_min(int b) const;
@@ -388,10 +428,18 @@ namespace Gecode { namespace Int {
    */
   class IntVarImpFwd {
   private:
-    /// Previous range
+    /// Previous range (range list representation)
     const IntVarImp::RangeList* p;
-    /// Current range
+    /// Current range (range list representation)
     const IntVarImp::RangeList* c;
+    /// Remaining values relative to \a b (bitset representation)
+    IntVarImp::Bits w;
+    /// Base value for remaining values (bitset representation)
+    int b;
+    /// Minimum of current range
+    int mi;
+    /// Maximum of current range
+    int ma;
   public:
     /// \name Constructors and initialization
     //@{
@@ -431,10 +479,18 @@ namespace Gecode { namespace Int {
    */
   class IntVarImpBwd {
   private:
-    /// Next range
+    /// Next range (range list representation)
     const IntVarImp::RangeList* n;
-    /// Current range
+    /// Current range (range list representation)
     const IntVarImp::RangeList* c;
+    /// Remaining values relative to \a b (bitset representation)
+    IntVarImp::Bits w;
+    /// Base value for remaining values (bitset representation)
+    int b;
+    /// Minimum of current range
+    int mi;
+    /// Maximum of current range
+    int ma;
   public:
     /// \name Constructors and initialization
     //@{
@@ -483,6 +539,20 @@ namespace Gecode { namespace Int {
   /**
    * \brief Boolean variable implementation
    *
+   * Boolean variable implementations are laid out to be cache friendly
+   * without requiring a separate packed representation:
+   *  - The domain is stored in two bits of the variable implementation
+   *    itself, which has no further data besides its subscriptions.
+   *  - All assigned variable implementations are replaced by the two
+   *    static instances \a s_zero and \a s_one, both when being created
+   *    and when being copied.
+   *  - Variable arrays create and copy their variable implementations
+   *    in decreasing index order from space memory that is allocated
+   *    downwards, so the implementations end up contiguous and in
+   *    increasing index order.
+   *  - During cloning, the subscriptions of all variables are copied
+   *    into a single contiguous memory area.
+   *
    * \ingroup Other
    */
   class BoolVarImp : public BoolVarImpBase {
@@ -49,11 +49,18 @@ namespace Gecode { namespace Int {
   int
   IntVarImp::med(void) const {
     // Computes the median
-    if (fst() == NULL)
+    if (holes == 0)
       return (dom.min()+dom.max())/2 - ((dom.min()+dom.max())%2 < 0 ? 1 : 0);
     unsigned int i = size() / 2;
     if (size() % 2 == 0)
       i--;
+    if (fst() == NULL) {
+      // Drop the i smallest values
+      Bits w = _bs;
+      while (i-- > 0)
+        w &= w - 1U;
+      return dom.min() + static_cast<int>(bs_lsb(w));
+    }
     const RangeList* p = NULL;
     const RangeList* c = fst();
     while (i >= c->width()) {
@@ -95,6 +102,11 @@ namespace Gecode { namespace Int {
     if (range()) { // Is already range...
       dom.max(m);
       if (assigned()) me = ME_INT_VAL;
+    } else if (fst() == NULL) { // Is bitset...
+      Bits w = _bs & bs_mask(0,static_cast<unsigned int>(m-dom.min()));
+      dom.max(dom.min()+static_cast<int>(bs_msb(w)));
+      holes = width() - bs_cnt(w); _bs = w;
+      if (assigned()) me = ME_INT_VAL;
     } else if (m < fst()->next(NULL)->min()) { // Becomes range...
       dom.max(std::min(m,fst()->max()));
       fst()->dispose(home,NULL,lst());
@@ -128,6 +140,12 @@ namespace Gecode { namespace Int {
     if (range()) { // Is already range...
       dom.min(m);
       if (assigned()) me = ME_INT_VAL;
+    } else if (fst() == NULL) { // Is bitset...
+      Bits w = _bs >> (m-dom.min());
+      unsigned int l = bs_lsb(w);
+      w >>= l; dom.min(m+static_cast<int>(l));
+      holes = width() - bs_cnt(w); _bs = w;
+      if (assigned()) me = ME_INT_VAL;
     } else if (m > lst()->prev(NULL)->max()) { // Becomes range...
       dom.min(std::max(m,lst()->min()));
       fst()->dispose(home,NULL,lst());
@@ -155,6 +173,14 @@ namespace Gecode { namespace Int {
 
   ModEvent
   IntVarImp::eq_full(Space& home, int m) {
+    if (bitset()) {
+      bool failed = ((_bs >> (m-dom.min())) & 1U) == 0U;
+      dom.min(m); dom.max(m); holes = 0;
+      if (failed)
+        return ME_INT_FAILED;
+      IntDelta d;
+      return notify(home,ME_INT_VAL,d);
+    }
     dom.min(m); dom.max(m);
     if (!range()) {
       bool failed = false;
@@ -191,6 +217,10 @@ namespace Gecode { namespace Int {
       } else if (m == dom.max()) {
         dom.max(m-1);
         me = assigned() ? ME_INT_VAL : ME_INT_BND;
+      } else if (width() <= bs_max) {
+        _bs = bs_mask(0,width()-1U) &
+          ~(static_cast<Bits>(1U) << (m-dom.min()));
+        holes = 1;
       } else {
         RangeList* f = new (home) RangeList(dom.min(),m-1);
         RangeList* l = new (home) RangeList(m+1,dom.max());
@@ -198,6 +228,19 @@ namespace Gecode { namespace Int {
         l->prevnext(f,NULL);
         fst(f); lst(l); holes = 1;
       }
+    } else if (fst() == NULL) { // Is bitset...
+      Bits w = _bs;
+      if (((w >> (m-dom.min())) & 1U) == 0U)
+        return ME_INT_NONE;
+      w &= ~(static_cast<Bits>(1U) << (m-dom.min()));
+      if ((m == dom.min()) || (m == dom.max())) {
+        unsigned int l = bs_lsb(w);
+        w >>= l; dom.min(dom.min()+static_cast<int>(l));
+        dom.max(dom.min()+static_cast<int>(bs_msb(w)));
+        me = ME_INT_BND;
+      }
+      holes = width() - bs_cnt(w); _bs = w;
+      if (assigned()) me = ME_INT_VAL;
     } else if (m < fst()->next(NULL)->min()) { // Concerns the first range...
       int f_max = fst()->max();
       if (m > f_max)
@@ -310,6 +353,42 @@ namespace Gecode { namespace Int {
 
 
 
+  /*
+   * Narrowing by bitsets
+   *
+   */
+
+  ModEvent
+  IntVarImp::bs_narrow(Space& home, int m, Bits w) {
+    assert(width() <= bs_max);
+    if (w == 0U)
+      return ME_INT_FAILED;
+    // Normalize such that the least significant bit corresponds to m
+    unsigned int l = bs_lsb(w);
+    w >>= l; m += static_cast<int>(l);
+    unsigned int s = bs_cnt(w);
+    assert(s <= size());
+    if (s == size())
+      return ME_INT_NONE;
+    if (fst() != NULL) {
+      fst()->dispose(home,NULL,lst());
+      fst(NULL);
+    }
+    const int min1 = dom.min(); dom.min(m);
+    const int max1 = dom.max(); dom.max(m+static_cast<int>(bs_msb(w)));
+    holes = width() - s; _bs = w;
+    ModEvent me;
+    if (s == 1U)
+      me = ME_INT_VAL;
+    else if ((min1 != dom.min()) || (max1 != dom.max()))
+      me = ME_INT_BND;
+    else
+      me = ME_INT_DOM;
+    IntDelta d;
+    return notify(home,me,d);
+  }
+
+
   /*
    * Copying variables
    *
@@ -319,7 +398,12 @@ namespace Gecode { namespace Int {
   IntVarImp::IntVarImp(Space& home, bool share, IntVarImp& x)
     : IntVarImpBase(home,share,x), dom(x.dom.min(),x.dom.max()) {
     holes = x.holes;
-    if (holes) {
+    if (holes == 0) {
+      fst(NULL);
+    } else if (width() <= bs_max) {
+      // Copying turns a small range list into a bitset
+      fst(NULL); _bs = x.bs();
+    } else {
       int m = 1;
       // Compute length
       {
@@ -346,8 +430,6 @@ namespace Gecode { namespace Int {
         RangeList* s_n=s_c->next(s_p); s_p=s_c; s_c=s_n;
       } while (s_c != NULL);
       d_c->next(NULL,NULL);
-    } else {
-      fst(NULL);
     }
   }
 
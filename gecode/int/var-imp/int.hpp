@@ -183,6 +183,104 @@ namespace Gecode { namespace Int {
     _lst = l;
   }
 
+
+  /*
+   * Maintaining bitsets for variable domain
+   *
+   */
+
+  forceinline IntVarImp::Bits
+  IntVarImp::bs_mask(unsigned int l, unsigned int h) {
+    assert((l <= h) && (h < bs_max));
+    Bits u = (h+1 == bs_max) ? ~static_cast<Bits>(0U) :
+      ((static_cast<Bits>(1U) << (h+1)) - 1U);
+    return u & ~((static_cast<Bits>(1U) << l) - 1U);
+  }
+
+  forceinline unsigned int
+  IntVarImp::bs_lsb(Bits w) {
+    assert(w != 0U);
+#if defined(__GNUC__)
+    return static_cast<unsigned int>(__builtin_ctzl(w));
+#elif defined(GECODE_SUPPORT_MSVC_64)
+    unsigned long int p;
+    _BitScanForward64(&p,w);
+    return static_cast<unsigned int>(p);
+#elif defined(GECODE_SUPPORT_MSVC_32)
+    unsigned long int p;
+    _BitScanForward(&p,w);
+    return static_cast<unsigned int>(p);
+#else
+    unsigned int p = 0;
+    while ((w & 1U) == 0U) {
+      w >>= 1; p++;
+    }
+    return p;
+#endif
+  }
+
+  forceinline unsigned int
+  IntVarImp::bs_msb(Bits w) {
+    assert(w != 0U);
+#if defined(__GNUC__)
+    return bs_max - 1U - static_cast<unsigned int>(__builtin_clzl(w));
+#elif defined(GECODE_SUPPORT_MSVC_64)
+    unsigned long int p;
+    _BitScanReverse64(&p,w);
+    return static_cast<unsigned int>(p);
+#elif defined(GECODE_SUPPORT_MSVC_32)
+    unsigned long int p;
+    _BitScanReverse(&p,w);
+    return static_cast<unsigned int>(p);
+#else
+    unsigned int p = 0;
+    while ((w >>= 1) != 0U)
+      p++;
+    return p;
+#endif
+  }
+
+  forceinline unsigned int
+  IntVarImp::bs_cnt(Bits w) {
+#if defined(__GNUC__)
+    return static_cast<unsigned int>(__builtin_popcountl(w));
+#else
+    unsigned int n = 0;
+    while (w != 0U) {
+      w &= w - 1U; n++;
+    }
+    return n;
+#endif
+  }
+
+  forceinline bool
+  IntVarImp::bitset(void) const {
+    return (holes > 0) && (fst() == NULL);
+  }
+
+  forceinline IntVarImp::Bits
+  IntVarImp::bs(void) const {
+    assert(width() <= bs_max);
+    if (holes == 0)
+      return bs_mask(0,width()-1);
+    if (fst() == NULL)
+      return _bs;
+    Bits w = 0U;
+    const RangeList* p = NULL;
+    const RangeList* c = fst();
+    do {
+      w |= bs_mask(static_cast<unsigned int>(c->min()-dom.min()),
+                   static_cast<unsigned int>(c->max()-dom.min()));
+      const RangeList* n=c->next(p); p=c; c=n;
+    } while (c != NULL);
+    return w;
+  }
+
+  forceinline void
+  IntVarImp::bs(Bits w) {
+    _bs = w;
+  }
+
   /*
    * Creation of new variable implementations
    *
@@ -195,7 +293,14 @@ namespace Gecode { namespace Int {
   forceinline
   IntVarImp::IntVarImp(Space& home, const IntSet& d)
     : IntVarImpBase(home), dom(d.min(),d.max()) {
-    if (d.ranges() > 1) {
+    if ((d.ranges() > 1) && (width() <= bs_max)) {
+      Bits w = 0U;
+      for (int i = 0; i < d.ranges(); i++)
+        w |= bs_mask(static_cast<unsigned int>(d.min(i)-d.min()),
+                     static_cast<unsigned int>(d.max(i)-d.min()));
+      fst(NULL); bs(w);
+      holes = width() - static_cast<unsigned int>(d.size());
+    } else if (d.ranges() > 1) {
       int n = d.ranges();
       assert(n >= 2);
       RangeList* r = home.alloc<RangeList>(n);
@@ -240,7 +345,7 @@ namespace Gecode { namespace Int {
 
   forceinline bool
   IntVarImp::range(void) const {
-    return fst() == NULL;
+    return holes == 0;
   }
   forceinline bool
   IntVarImp::assigned(void) const {
@@ -260,8 +365,10 @@ namespace Gecode { namespace Int {
 
   forceinline unsigned int
   IntVarImp::regret_min(void) const {
-    if (fst() == NULL) {
+    if (holes == 0) {
       return (dom.min() == dom.max()) ? 0U : 1U;
+    } else if (fst() == NULL) {
+      return bs_lsb(_bs >> 1) + 1U;
     } else if (dom.min() == fst()->max()) {
       return static_cast<unsigned int>(fst()->next(NULL)->min()-dom.min());
     } else {
@@ -270,8 +377,11 @@ namespace Gecode { namespace Int {
   }
   forceinline unsigned int
   IntVarImp::regret_max(void) const {
-    if (fst() == NULL) {
+    if (holes == 0) {
       return (dom.min() == dom.max()) ? 0U : 1U;
+    } else if (fst() == NULL) {
+      unsigned int h = width() - 1U;
+      return h - bs_msb(_bs & ~(static_cast<Bits>(1U) << h));
     } else if (dom.max() == lst()->min()) {
       return static_cast<unsigned int>(dom.max()-lst()->prev(NULL)->max());
     } else {
@@ -290,29 +400,17 @@ namespace Gecode { namespace Int {
   IntVarImp::in(int n) const {
     if ((n < dom.min()) || (n > dom.max()))
       return false;
-    return (fst() == NULL) || in_full(n);
+    if (holes == 0)
+      return true;
+    if (fst() == NULL)
+      return ((_bs >> (n-dom.min())) & 1U) != 0U;
+    return in_full(n);
   }
   forceinline bool
   IntVarImp::in(long long int n) const {
     if ((n < dom.min()) || (n > dom.max()))
       return false;
-    return (fst() == NULL) || in_full(static_cast<int>(n));
-  }
-
-
-  /*
-   * Accessing rangelists for iteration
-   *
-   */
-
-  forceinline const IntVarImp::RangeList*
-  IntVarImp::ranges_fwd(void) const {
-    return (fst() == NULL) ? &dom : fst();
-  }
-
-  forceinline const IntVarImp::RangeList*
-  IntVarImp::ranges_bwd(void) const {
-    return (fst() == NULL) ? &dom : lst();
+    return in(static_cast<int>(n));
   }
 
 
@@ -419,78 +517,130 @@ namespace Gecode { namespace Int {
 
 
   /*
-   * Forward range iterator for rangelists
+   * Forward range iterator for variable domains
    *
    */
 
   forceinline
   IntVarImpFwd::IntVarImpFwd(void) {}
   forceinline
-  IntVarImpFwd::IntVarImpFwd(const IntVarImp* x)
-    : p(NULL), c(x->ranges_fwd()) {}
+  IntVarImpFwd::IntVarImpFwd(const IntVarImp* x) {
+    init(x);
+  }
   forceinline void
   IntVarImpFwd::init(const IntVarImp* x) {
-    p=NULL; c=x->ranges_fwd();
+    p=NULL; c=x->fst(); w=0U; b=0;
+    if (x->holes == 0) {
+      mi=x->min(); ma=x->max();
+    } else if (c == NULL) {
+      w=x->_bs; b=x->min();
+      operator ++();
+    } else {
+      mi=c->min(); ma=c->max();
+    }
   }
 
   forceinline bool
   IntVarImpFwd::operator ()(void) const {
-    return c != NULL;
+    return mi <= ma;
   }
   forceinline void
   IntVarImpFwd::operator ++(void) {
-    const IntVarImp::RangeList* n=c->next(p); p=c; c=n;
+    if (c != NULL) {
+      const IntVarImp::RangeList* n=c->next(p); p=c; c=n;
+      if (c != NULL) {
+        mi=c->min(); ma=c->max();
+      } else {
+        mi=1; ma=0;
+      }
+    } else if (w != 0U) {
+      // Skip values not in the domain
+      unsigned int s = IntVarImp::bs_lsb(w);
+      w >>= s; b += static_cast<int>(s);
+      // Collect values in the domain
+      unsigned int l = IntVarImp::bs_lsb(~w);
+      mi=b; ma=b+static_cast<int>(l)-1;
+      w >>= l; b += static_cast<int>(l);
+    } else {
+      mi=1; ma=0;
+    }
   }
 
   forceinline int
   IntVarImpFwd::min(void) const {
-    return c->min();
+    return mi;
   }
   forceinline int
   IntVarImpFwd::max(void) const {
-    return c->max();
+    return ma;
   }
   forceinline unsigned int
   IntVarImpFwd::width(void) const {
-    return c->width();
+    return static_cast<unsigned int>(ma-mi)+1U;
   }
 
 
   /*
-   * Backward range iterator for rangelists
+   * Backward range iterator for variable domains
    *
    */
 
   forceinline
   IntVarImpBwd::IntVarImpBwd(void) {}
   forceinline
-  IntVarImpBwd::IntVarImpBwd(const IntVarImp* x)
-    : n(NULL), c(x->ranges_bwd()) {}
+  IntVarImpBwd::IntVarImpBwd(const IntVarImp* x) {
+    init(x);
+  }
   forceinline void
   IntVarImpBwd::init(const IntVarImp* x) {
-    n=NULL; c=x->ranges_bwd();
+    n=NULL; c=NULL; w=0U; b=0;
+    if (x->holes == 0) {
+      mi=x->min(); ma=x->max();
+    } else if (x->fst() == NULL) {
+      w=x->_bs; b=x->min();
+      operator ++();
+    } else {
+      c=x->lst(); mi=c->min(); ma=c->max();
+    }
   }
 
   forceinline bool
   IntVarImpBwd::operator ()(void) const {
-    return c != NULL;
+    return mi <= ma;
   }
   forceinline void
   IntVarImpBwd::operator ++(void) {
-    const IntVarImp::RangeList* p=c->prev(n); n=c; c=p;
+    if (c != NULL) {
+      const IntVarImp::RangeList* p=c->prev(n); n=c; c=p;
+      if (c != NULL) {
+        mi=c->min(); ma=c->max();
+      } else {
+        mi=1; ma=0;
+      }
+    } else if (w != 0U) {
+      // Largest value in the domain
+      unsigned int h = IntVarImp::bs_msb(w);
+      // Values below h that are not in the domain
+      IntVarImp::Bits z = ~w & IntVarImp::bs_mask(0,h);
+      unsigned int l = (z == 0U) ? 0U : IntVarImp::bs_msb(z)+1U;
+      mi=b+static_cast<int>(l); ma=b+static_cast<int>(h);
+      w = (l == 0U) ? 0U : (w & IntVarImp::bs_mask(0,l-1U));
+    } else {
+      mi=1; ma=0;
+    }
   }
 
   forceinline int
   IntVarImpBwd::min(void) const {
-    return c->min();
+    return mi;
   }
   forceinline int
   IntVarImpBwd::max(void) const {
-    return c->max();
+    return ma;
   }
   forceinline unsigned int
   IntVarImpBwd::width(void) const {
-    return c->width();
+    return static_cast<unsigned int>(ma-mi)+1U;
   }
 
 
@@ -517,8 +667,9 @@ namespace Gecode { namespace Int {
       // must have been narrowed!)
       if (fst()) {
         fst()->dispose(home,NULL,lst());
-        fst(NULL); holes = 0;
+        fst(NULL);
       }
+      holes = 0;
       const int min1 = dom.min(); dom.min(min0);
       const int max1 = dom.max(); dom.max(max0);
       if ((min0 == min1) && (max0 == max1))
@@ -527,6 +678,19 @@ namespace Gecode { namespace Int {
       goto notify;
     }
 
+    // Is the new domain small enough for a bitset?
+    if (width() <= bs_max) {
+      assert((min0 >= dom.min()) && (max0 <= dom.max()));
+      Bits w = bs_mask(0,static_cast<unsigned int>(max0-min0));
+      do {
+        assert(ri.max() <= dom.max());
+        w |= bs_mask(static_cast<unsigned int>(ri.min()-min0),
+                     static_cast<unsigned int>(ri.max()-min0));
+        ++ri;
+      } while (ri());
+      return bs_narrow(home,min0,w);
+    }
+
     if (depends || range()) {
       // Construct new rangelist
       RangeList*   f = new (home) RangeList(min0,max0,NULL,NULL);
@@ -704,6 +868,24 @@ namespace Gecode { namespace Int {
         (!i() || (i.min() > dom.max())))
       return gq(home,i_max+1);
 
+    // Remove values from bitset?
+    if (width() <= bs_max) {
+      int m = dom.min();
+      Bits w = bs();
+      while (true) {
+        int l = std::max(i_min,m);
+        int h = std::min(i_max,dom.max());
+        w &= ~bs_mask(static_cast<unsigned int>(l-m),
+                      static_cast<unsigned int>(h-m));
+        if (!i() || (i.min() > dom.max()))
+          break;
+        i_min = i.min();
+        i_max = i.max();
+        ++i;
+      }
+      return bs_narrow(home,m,w);
+    }
+
     // Set up two sentinel elements
     RangeList f, l;
     // Put all ranges between sentinels
@@ -870,6 +1052,17 @@ namespace Gecode { namespace Int {
     if (!i() || (i.val() > dom.max()))
       return nq_full(home,v);
 
+    // Remove values from bitset?
+    if (width() <= bs_max) {
+      int m = dom.min();
+      Bits w = bs() & ~(static_cast<Bits>(1U) << (v-m));
+      do {
+        w &= ~(static_cast<Bits>(1U) << (i.val()-m));
+        ++i;
+      } while (i() && (i.val() <= dom.max()));
+      return bs_narrow(home,m,w);
+    }
+
     // Set up two sentinel elements
     RangeList f, l;
     // Put all ranges between sentinels
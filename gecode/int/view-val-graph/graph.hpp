@@ -134,10 +134,12 @@ namespace Gecode { namespace Int { namespace ViewValGraph {
   Graph<View>::purge(void) {
     if (count > (UINT_MAX >> 1)) {
       count = 1;
-      for (int i=n_view; i--; )
-        view[i]->min = 0;
-      for (ValNode<View>* v = val; v != NULL; v = v->next_val())
-        v->min = 0;
+      for (int i=n_view; i--; ) {
+        view[i]->min = 0; view[i]->comp = 0;
+      }
+      for (ValNode<View>* v = val; v != NULL; v = v->next_val()) {
+        v->min = 0; v->comp = 0;
+      }
     }
   }
 
@@ -44,7 +44,7 @@ namespace Gecode { namespace Int { namespace ViewValGraph {
 
   template<class View>
   forceinline
-  Node<View>::Node(void) : min(0) {
+  Node<View>::Node(void) : min(0), comp(0) {
     // Must be initialized such that the node is considered unvisited initially
   }
   template<class View>
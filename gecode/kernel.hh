@@ -123,6 +123,7 @@
  */
 
 #include <gecode/kernel/archive.hpp>
+#include <gecode/kernel/profiler.hpp>
 #include <gecode/kernel/gpi.hpp>
 #include <gecode/kernel/core.hpp>
 #include <gecode/kernel/modevent.hpp>
@@ -159,6 +160,7 @@
 
 #include <gecode/kernel/array.hpp>
 #include <gecode/kernel/shared-array.hpp>
+#include <gecode/kernel/cow-array.hpp>
 
 
 /*
@@ -97,6 +97,59 @@ namespace Gecode {
     Advisor::dispose(home,c);
   }
 
+
+  /**
+   * \brief Batched advisor storing a single view
+   *
+   */
+  template<class View>
+  class BatchViewAdvisor : public BatchAdvisor {
+  protected:
+    /// The single view
+    View x;
+  public:
+    /// Constructor for creation
+    template<class A>
+    BatchViewAdvisor(Space& home, Propagator& p, BatchCouncil<A>& c,
+                     View x0);
+    /// Constructor for cloning \a a
+    BatchViewAdvisor(Space& home, bool share, BatchViewAdvisor<View>& a);
+    /// Access view
+    View view(void) const;
+    /// Delete advisor
+    template<class A>
+    void dispose(Space& home, Council<A>& c);
+  };
+
+
+  template<class View>
+  template<class A>
+  forceinline
+  BatchViewAdvisor<View>::BatchViewAdvisor(Space& home, Propagator& p,
+                                           BatchCouncil<A>& c, View x0)
+    : BatchAdvisor(home,p,c), x(x0) {
+    x.subscribe(home,*this);
+  }
+  template<class View>
+  forceinline
+  BatchViewAdvisor<View>::BatchViewAdvisor(Space& home, bool share,
+                                           BatchViewAdvisor<View>& a)
+    : BatchAdvisor(home,share,a) {
+    x.update(home,share,a.x);
+  }
+  template<class View>
+  forceinline View
+  BatchViewAdvisor<View>::view(void) const {
+    return x;
+  }
+  template<class View>
+  template<class A>
+  forceinline void
+  BatchViewAdvisor<View>::dispose(Space& home, Council<A>& c) {
+    x.cancel(home,*this);
+    Advisor::dispose(home,c);
+  }
+
 }
 
 // STATISTICS: kernel-other
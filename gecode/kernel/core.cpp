@@ -37,6 +37,10 @@
 
 #include <gecode/kernel.hh>
 
+#ifdef GECODE_PROPAGATION_PROFILER
+#include <typeinfo>
+#endif
+
 namespace Gecode {
 
   /*
@@ -110,7 +114,8 @@ namespace Gecode {
 #endif
 
   Space::Space(void)
-    : sm(new SharedMemory), mm(sm), _wmp_afc(0U) {
+    : sm(new (MemoryConfig::region_area_size) SharedMemory(MemoryPolicy())),
+      mm(sm), _wmp_afc(0U) {
 #ifdef GECODE_HAS_VAR_DISPOSE
     for (int i=0; i<AllVarConf::idx_d; i++)
       _vars_d[i] = NULL;
@@ -194,6 +199,21 @@ namespace Gecode {
   Space::flush(void) {
     // Flush malloc cache
     sm->flush();
+    // Flush heap chunks pooled by the current thread
+    if (HeapChunkPool* p = HeapChunkPool::current())
+      p->flush();
+  }
+
+  void
+  Space::memory(const MemoryPolicy& mp) {
+    sm->policy(mp);
+    mm.policy(sm);
+  }
+
+  void
+  Space::scheduling(const SchedulingPolicy& sp0) {
+    sp = sp0;
+    sp.normalize();
   }
 
   Space::~Space(void) {
@@ -230,6 +250,30 @@ namespace Gecode {
    *
    */
 
+#ifdef GECODE_PROPAGATION_PROFILER
+  forceinline ExecStatus
+  Space::profile(Propagator& p, const ModEventDelta& med) {
+    PropagatorProfile& pp = p.gpi().profile;
+    if (Support::atomic_relaxed_load(pp.name) == NULL)
+      Support::atomic_relaxed_store(pp.name,typeid(p).name());
+    unsigned long long int c = Support::cycles();
+    ExecStatus es = p.propagate(*this,med);
+    c = Support::cycles() - c;
+    Support::atomic_relaxed_add(pp.propagate,1ULL);
+    Support::atomic_relaxed_add(pp.cycles,c);
+    switch (es) {
+    case ES_FAILED:
+      Support::atomic_relaxed_add(pp.failed,1ULL); break;
+    case __ES_SUBSUMED:
+      Support::atomic_relaxed_add(pp.subsumed,1ULL); break;
+    case ES_NOFIX: case __ES_PARTIAL:
+      Support::atomic_relaxed_add(pp.nofix,1ULL); break;
+    default: break;
+    }
+    return es;
+  }
+#endif
+
   SpaceStatus
   Space::status(StatusStatistics& stat) {
     SpaceStatus s = SS_FAILED;
@@ -244,6 +288,7 @@ namespace Gecode {
       goto unstable;
     execute:
       stat.propagate++;
+      stat.propagate_queue[pc.p.active - &pc.p.queue[0]]++;
       if (p->disabled())
         goto put_into_idle;
       pc.p.ei.propagator(*p);
@@ -251,7 +296,11 @@ namespace Gecode {
       med_o = p->u.med;
       // Clear med but leave propagator in queue
       p->u.med = 0;
+#ifdef GECODE_PROPAGATION_PROFILER
+      switch (profile(*p,med_o)) {
+#else
       switch (p->propagate(*this,med_o)) {
+#endif
       case ES_FAILED:
         // Count failure
         if (afc_enabled())
@@ -488,7 +537,7 @@ namespace Gecode {
       mm(sm,s.mm,s.pc.p.n_sub*sizeof(Propagator**)),
       gpi(s.gpi),
       d_fst(&Actor::sentinel),
-      _wmp_afc(s._wmp_afc) {
+      _wmp_afc(s._wmp_afc), sp(s.sp) {
 #ifdef GECODE_HAS_VAR_DISPOSE
     for (int i=0; i<AllVarConf::idx_d; i++)
       _vars_d[i] = NULL;
@@ -594,7 +643,13 @@ namespace Gecode {
           ActorLink* a = p->u.advisors;
           p->u.advisors = NULL;
           do {
-            a->prev(p); a = a->next();
+            // The forwarded advisor knows whether the advisor is batched
+            if (Advisor::cast(a->prev())->batched())
+              a->prev(static_cast<ActorLink*>
+                      (Support::mark(ActorLink::cast(p))));
+            else
+              a->prev(p);
+            a = a->next();
           } while (a != NULL);
         }
         c_a->prev(p_a); p_a = c_a; c_a = c_a->next();
@@ -58,7 +58,8 @@ namespace Gecode {
    * Shared handles provide access to reference-counted objects. In
    * particular, they support updates with and without sharing.
    * An update with sharing just updates the handle, while a non-shared
-   * update creates a single copy per space.
+   * update creates a single copy per space. Immutable objects are
+   * never copied.
    *
    * \ingroup FuncSupport
    */
@@ -93,13 +94,21 @@ namespace Gecode {
       Object* next;
       /// The forwarding pointer
       Object* fwd;
-      /// The counter used for reference counting
+      /// The counter used for reference counting (updated atomically)
       unsigned int use_cnt;
     public:
       /// Initialize
       Object(void);
       /// Return fresh copy for update
       virtual Object* copy(void) const = 0;
+      /**
+       * \brief Whether the object cannot change anymore
+       *
+       * An immutable object is never copied during cloning, not even
+       * when cloning must not share data (for example, for a clone
+       * used by a different thread). The default is false.
+       */
+      virtual bool immutable(void) const;
       /// Delete shared object
       virtual ~Object(void);
     };
@@ -609,6 +618,41 @@ namespace Gecode {
     static PropCost unary(PropCost::Mod m);
   };
 
+  /**
+   * \brief Policy for scheduling propagators
+   *
+   * A space keeps one queue of propagators per actual cost (see
+   * PropCost) and always executes the queue with the largest cost
+   * value (that is, the cheapest propagators) first. A scheduling
+   * policy can change this as follows:
+   *  - Propagators of a given actual cost can be put into a different
+   *    queue (for example, to execute expensive global propagators
+   *    only after all other propagators have reached a fixpoint).
+   *  - A queue can be executed in last-in first-out rather than in
+   *    first-in first-out order.
+   *  - Propagators with an AFC (see AFC) of at least \a afc_promote
+   *    are put into the next cheaper queue, so that propagators that
+   *    are likely to fail are executed earlier. This requires that
+   *    AFC information is recorded.
+   *
+   * The queue for AC_RECORD is reserved and never changed.
+   *
+   * \ingroup TaskActor
+   */
+  class SchedulingPolicy {
+  public:
+    /// Queue for propagators of actual cost (default: same cost)
+    PropCost::ActualCost queue[PropCost::AC_MAX+1];
+    /// Whether a queue is executed in LIFO order (default: false)
+    bool lifo[PropCost::AC_MAX+1];
+    /// AFC from which propagators are promoted (default: 0.0, none)
+    double afc_promote;
+    /// Initialize with default policy
+    SchedulingPolicy(void);
+    /// Make policy consistent
+    void normalize(void);
+  };
+
 
   /**
    * \brief Actor properties
@@ -1214,9 +1258,14 @@ namespace Gecode {
     template<class A> friend class Council;
     template<class A> friend class Advisors;
     friend class SubscribedPropagators;
+    friend class BatchAdvisor;
+    template<class A> friend class BatchCouncil;
+    friend class Space;
   private:
     /// Is the advisor disposed?
     bool disposed(void) const;
+    /// Whether modifications are batched (see BatchAdvisor)
+    bool batched(void) const;
     /// Static cast
     static Advisor* cast(ActorLink* al);
     /// Static cast
@@ -1252,6 +1301,70 @@ namespace Gecode {
     static void* operator new(size_t s);
   };
 
+  template<class A> class BatchCouncil;
+
+  /**
+   * \brief Base-class for advisors with batched modifications
+   *
+   * The kernel does not call the advise function of the propagator
+   * for a batched advisor. Instead, when a view the advisor is
+   * subscribed to is modified, the advisor is recorded as pending in
+   * its council (if it is not pending already) and the propagator is
+   * scheduled with the modification event. The propagator then
+   * processes all pending advisors when it is executed (see
+   * BatchCouncil::pending). This saves a virtual function call per
+   * modification and lets the propagator process all modifications
+   * at once.
+   *
+   * As no delta information is available, batching is only suitable
+   * if the modification can be recovered from the view itself (for
+   * example, for Boolean views or for views that are only watched for
+   * becoming assigned).
+   *
+   * \ingroup TaskActor
+   */
+  class BatchAdvisor : public Advisor {
+    template<class VIC> friend class VarImp;
+    template<class A> friend class BatchCouncil;
+  private:
+    /// Next pending advisor (NULL for last, this if not pending)
+    BatchAdvisor* np;
+    /// List of pending advisors of the council
+    BatchAdvisor** pl;
+    /// Record advisor as pending
+    void record(void);
+  public:
+    /// Constructor for creation
+    template<class A>
+    BatchAdvisor(Space& home, Propagator& p, BatchCouncil<A>& c);
+    /// Copying constructor
+    BatchAdvisor(Space& home, bool share, BatchAdvisor& a);
+    /// Test whether advisor is pending
+    bool pending(void) const;
+  };
+
+  /**
+   * \brief %Council of advisors with batched modifications
+   *
+   * \ingroup TaskActor
+   */
+  template<class A>
+  class BatchCouncil : public Council<A> {
+    friend class BatchAdvisor;
+  private:
+    /// Pending advisors
+    BatchAdvisor* p;
+  public:
+    /// Default constructor
+    BatchCouncil(void);
+    /// Construct advisor council
+    BatchCouncil(Space& home);
+    /// Update during cloning (copies all advisors)
+    void update(Space& home, bool share, BatchCouncil<A>& c);
+    /// Return next pending advisor and remove it (NULL if none)
+    A* pending(void);
+  };
+
 
   /**
    * \brief No-good literal recorded during search
@@ -1518,6 +1631,8 @@ namespace Gecode {
   protected:
     /// Number of no-goods
     unsigned long int n;
+    /// Maximal number of no-good propagators kept (0 for no limit)
+    unsigned int m;
   public:
     /// Initialize
     NoGoods(void);
@@ -1528,6 +1643,10 @@ namespace Gecode {
     unsigned long int ng(void) const;
     /// %Set number of no-goods posted to \a n
     void ng(unsigned long int n);
+    /// Return maximal number of no-good propagators kept (0 for no limit)
+    unsigned int ngmax(void) const;
+    /// %Set maximal number of no-good propagators kept to \a m
+    void ngmax(unsigned int m);
     /// Destructor
     virtual ~NoGoods(void);
     /// Empty no-goods
@@ -1621,6 +1740,8 @@ namespace Gecode {
   public:
     /// Number of propagator executions
     unsigned long int propagate;
+    /// Number of propagator executions per queue
+    unsigned long int propagate_queue[PropCost::AC_MAX+1];
     /// Whether a weakly monotonic propagator might have been executed
     bool wmp;
     /// Initialize
@@ -1769,6 +1890,10 @@ namespace Gecode {
     } pc;
     /// Put propagator \a p into right queue
     void enqueue(Propagator* p);
+#ifdef GECODE_PROPAGATION_PROFILER
+    /// Execute propagator \a p for \a med and record profile information
+    ExecStatus profile(Propagator& p, const ModEventDelta& med);
+#endif
     /**
      * \name update, and dispose variables
      */
@@ -1806,6 +1931,8 @@ namespace Gecode {
      * one.
      */
     unsigned int _wmp_afc;
+    /// Policy for scheduling propagators
+    SchedulingPolicy sp;
     /// %Set that AFC information must be recorded
     void afc_enable(void);
     /// Whether AFC information must be recorded
@@ -2540,10 +2667,22 @@ namespace Gecode {
      *
      * All spaces that are obtained as non-shared clones from some same space
      * try to cache memory blocks from failed spaces. To minimize memory
-     * consumption, these blocks can be flushed.
+     * consumption, these blocks can be flushed. Also flushes the memory
+     * blocks pooled by the current thread (see HeapChunkPool).
      *
      */
     GECODE_KERNEL_EXPORT void flush(void);
+    /**
+     * \brief Set memory management policy to \a mp
+     *
+     * The policy is shared with all clones that share memory with
+     * this space (see clone), non-shared clones copy the policy.
+     * Must not be called while a Region for the space is in use.
+     *
+     */
+    GECODE_KERNEL_EXPORT void memory(const MemoryPolicy& mp);
+    /// Return memory management policy
+    const MemoryPolicy& memory(void) const;
     //@}
     /// Construction routines
     //@{
@@ -2601,6 +2740,20 @@ namespace Gecode {
     void afc_set(double a);
     //@}
 
+    /// \name Propagator scheduling
+    //@{
+    /**
+     * \brief %Set propagator scheduling policy to \a sp
+     *
+     * The policy is copied to all clones and only affects propagators
+     * scheduled after it has been set.
+     */
+    GECODE_KERNEL_EXPORT
+    void scheduling(const SchedulingPolicy& sp);
+    /// Return propagator scheduling policy
+    const SchedulingPolicy& scheduling(void) const;
+    //@}
+
   private:
     /**
      * \brief Class to iterate over propagators of a space
@@ -2996,6 +3149,10 @@ namespace Gecode {
   forceinline
   SharedHandle::Object::Object(void)
     : next(NULL), fwd(NULL), use_cnt(0) {}
+  forceinline bool
+  SharedHandle::Object::immutable(void) const {
+    return false;
+  }
   forceinline
   SharedHandle::Object::~Object(void) {
     assert(use_cnt == 0);
@@ -3007,11 +3164,11 @@ namespace Gecode {
   }
   forceinline void
   SharedHandle::subscribe(void) {
-    if (o != NULL) o->use_cnt++;
+    if (o != NULL) (void) Support::atomic_add(o->use_cnt,1U);
   }
   forceinline void
   SharedHandle::cancel(void) {
-    if ((o != NULL) && (--o->use_cnt == 0))
+    if ((o != NULL) && (Support::atomic_sub(o->use_cnt,1U) == 0U))
       delete o;
     o=NULL;
   }
@@ -3042,7 +3199,7 @@ namespace Gecode {
   SharedHandle::update(Space& home, bool share, SharedHandle& sh) {
     if (sh.o == NULL) {
       o=NULL; return;
-    } else if (share) {
+    } else if (share || sh.o->immutable()) {
       o=sh.o;
     } else if (sh.o->fwd != NULL) {
       o=sh.o->fwd;
@@ -3067,7 +3224,7 @@ namespace Gecode {
    */
   forceinline
   NoGoods::NoGoods(void)
-    : n(0) {}
+    : n(0), m(0) {}
   forceinline unsigned long int
   NoGoods::ng(void) const {
     return n;
@@ -3076,6 +3233,14 @@ namespace Gecode {
   NoGoods::ng(unsigned long int n0) {
     n=n0;
   }
+  forceinline unsigned int
+  NoGoods::ngmax(void) const {
+    return m;
+  }
+  forceinline void
+  NoGoods::ngmax(unsigned int m0) {
+    m=m0;
+  }
   forceinline
   NoGoods::~NoGoods(void) {}
 
@@ -3277,6 +3442,11 @@ namespace Gecode {
     return gpi.decay();
   }
 
+  forceinline const MemoryPolicy&
+  Space::memory(void) const {
+    return sm->policy();
+  }
+
   forceinline size_t
   Actor::dispose(Space&) {
     return sizeof(*this);
@@ -3423,6 +3593,11 @@ namespace Gecode {
     gpi_disabled = Support::funmark(gpi_disabled);
   }
 
+  forceinline void
+  Propagator::kill(Space& home) {
+    home.kill(*this);
+  }
+
   forceinline GPI::Info&
   Propagator::gpi(void) {
     return *static_cast<GPI::Info*>(Support::funmark(gpi_disabled));
@@ -3762,6 +3937,11 @@ namespace Gecode {
     return prev() == NULL;
   }
 
+  forceinline bool
+  Advisor::batched(void) const {
+    return Support::marked(prev());
+  }
+
   forceinline Advisor*
   Advisor::cast(ActorLink* al) {
     return static_cast<Advisor*>(al);
@@ -3775,7 +3955,8 @@ namespace Gecode {
   forceinline Propagator&
   Advisor::propagator(void) const {
     assert(!disposed());
-    return *Propagator::cast(ActorLink::prev());
+    return *Propagator::cast(static_cast<ActorLink*>
+                             (Support::funmark(ActorLink::prev())));
   }
 
   template<class A>
@@ -3866,8 +4047,12 @@ namespace Gecode {
         } else {
           // Run specific copying part
           A* a = new (home) A(home,share,*static_cast<A*>(*a_f));
-          // Set propagator pointer
-          a->prev(p_t);
+          // Set propagator pointer (keep whether batched)
+          if (static_cast<A*>(*a_f)->batched())
+            a->prev(static_cast<ActorLink*>
+                    (Support::mark(ActorLink::cast(p_t))));
+          else
+            a->prev(p_t);
           // Set forwarding pointer
           (*a_f)->prev(a);
           // Link
@@ -3898,6 +4083,72 @@ namespace Gecode {
 
 
 
+  /*
+   * Batched advisors
+   *
+   */
+  template<class A>
+  forceinline
+  BatchAdvisor::BatchAdvisor(Space& home, Propagator& p, BatchCouncil<A>& c)
+    : Advisor(home,p,c), np(this), pl(&c.p) {
+    // Mark propagator pointer to indicate batching
+    ActorLink::prev(static_cast<ActorLink*>(Support::mark(ActorLink::prev())));
+  }
+
+  forceinline
+  BatchAdvisor::BatchAdvisor(Space& home, bool share, BatchAdvisor& a)
+    : Advisor(home,share,a), np(a.pending() ? NULL : this), pl(NULL) {}
+
+  forceinline bool
+  BatchAdvisor::pending(void) const {
+    return np != this;
+  }
+
+  forceinline void
+  BatchAdvisor::record(void) {
+    if (np == this) {
+      np = *pl; *pl = this;
+    }
+  }
+
+  template<class A>
+  forceinline
+  BatchCouncil<A>::BatchCouncil(void) {}
+
+  template<class A>
+  forceinline
+  BatchCouncil<A>::BatchCouncil(Space& home)
+    : Council<A>(home), p(NULL) {}
+
+  template<class A>
+  forceinline void
+  BatchCouncil<A>::update(Space& home, bool share, BatchCouncil<A>& c) {
+    Council<A>::update(home,share,c);
+    // Link advisors to this council and re-create pending list
+    p = NULL;
+    for (Advisors<A> as(*this); as(); ++as) {
+      BatchAdvisor& a = as.advisor();
+      a.pl = &p;
+      if (a.pending()) {
+        a.np = p; p = &a;
+      }
+    }
+  }
+
+  template<class A>
+  forceinline A*
+  BatchCouncil<A>::pending(void) {
+    while (p != NULL) {
+      BatchAdvisor* a = p;
+      p = a->np; a->np = a;
+      if (!a->disposed())
+        return static_cast<A*>(a);
+    }
+    return NULL;
+  }
+
+
+
   /*
    * Advisor iterator
    *
@@ -3939,12 +4190,24 @@ namespace Gecode {
   forceinline void
   Space::enqueue(Propagator* p) {
     ActorLink::cast(p)->unlink();
-    ActorLink* c = &pc.p.queue[p->cost(*this,p->u.med).ac];
-    c->tail(ActorLink::cast(p));
+    int q = sp.queue[p->cost(*this,p->u.med).ac];
+    if ((sp.afc_promote > 0.0) && (q > PropCost::AC_RECORD) &&
+        (q < PropCost::AC_MAX) && (p->afc(*this) >= sp.afc_promote))
+      q++;
+    ActorLink* c = &pc.p.queue[q];
+    if (sp.lifo[q])
+      c->head(ActorLink::cast(p));
+    else
+      c->tail(ActorLink::cast(p));
     if (c > pc.p.active)
       pc.p.active = c;
   }
 
+  forceinline const SchedulingPolicy&
+  Space::scheduling(void) const {
+    return sp;
+  }
+
   forceinline void
   Space::fail(void) {
     /*
@@ -4376,6 +4639,12 @@ namespace Gecode {
       Advisor* a = Advisor::cast(*la);
       assert(!a->disposed());
       Propagator& p = a->propagator();
+      if (a->batched()) {
+        // Only record modification, propagator processes it later
+        static_cast<BatchAdvisor*>(a)->record();
+        schedule(home,p,me);
+        continue;
+      }
       switch (p.advise(home,*a,d)) {
       case ES_FIX:
         break;
@@ -4468,6 +4737,8 @@ namespace Gecode {
   forceinline void
   StatusStatistics::reset(void) {
     propagate = 0;
+    for (int i=0; i<=PropCost::AC_MAX; i++)
+      propagate_queue[i] = 0;
     wmp = false;
   }
   forceinline
@@ -4477,6 +4748,8 @@ namespace Gecode {
   forceinline StatusStatistics&
   StatusStatistics::operator +=(const StatusStatistics& s) {
     propagate += s.propagate;
+    for (int i=0; i<=PropCost::AC_MAX; i++)
+      propagate_queue[i] += s.propagate_queue[i];
     wmp |= s.wmp;
     return *this;
   }
@@ -4595,6 +4868,28 @@ namespace Gecode {
     return (m == LO) ? AC_UNARY_LO : AC_UNARY_HI;
   }
 
+
+  /*
+   * Scheduling policy
+   *
+   */
+  forceinline
+  SchedulingPolicy::SchedulingPolicy(void) : afc_promote(0.0) {
+    for (int i=0; i<=PropCost::AC_MAX; i++) {
+      queue[i] = static_cast<PropCost::ActualCost>(i);
+      lifo[i] = false;
+    }
+  }
+  forceinline void
+  SchedulingPolicy::normalize(void) {
+    queue[PropCost::AC_RECORD] = PropCost::AC_RECORD;
+    for (int i=PropCost::AC_RECORD+1; i<=PropCost::AC_MAX; i++)
+      if ((queue[i] <= PropCost::AC_RECORD) || (queue[i] > PropCost::AC_MAX))
+        queue[i] = static_cast<PropCost::ActualCost>(i);
+    if (afc_promote < 0.0)
+      afc_promote = 0.0;
+  }
+
   /*
    * Iterators for propagators and branchers of a space
    *
@@ -0,0 +1,200 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode {
+
+  /**
+   * \brief Copy-on-write array
+   *
+   * The elements are stored in heap-allocated pages of \f$2^{lps}\f$
+   * elements. When an actor is copied during cloning, only the table
+   * of pages is copied and all pages are shared with the original.
+   * A page is copied only when one of its elements is written while
+   * the page is still shared. Hence, copying takes time linear in the
+   * number of pages and only modified pages are ever duplicated.
+   *
+   * As pages are reference counted by atomic operations, they are
+   * shared regardless of whether cloning shares data or not.
+   *
+   * The elements are copied bitwise and must not refer to anything
+   * allocated in a space (such as views or space memory). An actor
+   * using a copy-on-write array must register for disposal
+   * (AP_DISPOSE) and dispose the array.
+   *
+   * \ingroup FuncSupportShared
+   */
+  template<class T, unsigned int lps=6>
+  class CowArray {
+  protected:
+    /// Number of elements per page
+    static const int ps = 1 << lps;
+    /// %Page of elements
+    class Page {
+    public:
+      /// Number of arrays using the page
+      unsigned int use_cnt;
+      /// The elements
+      T a[ps];
+      /// Allocate page used by a single array
+      static Page* allocate(void);
+      /// Allocate copy of page used by a single array
+      Page* copy(void) const;
+      /// Release page and free it if no longer used
+      void release(void);
+    };
+    /// The pages
+    Page** p;
+    /// Number of elements
+    int n;
+    /// Return number of pages
+    int pages(void) const;
+  public:
+    /// Default constructor (array must be initialized or updated)
+    CowArray(void);
+    /// Initialize for \a n elements with value \a t
+    void init(Space& home, int n, const T& t=T());
+    /// Update array to be a clone of array \a a
+    void update(Space& home, bool share, CowArray& a);
+    /// Release memory used by the array
+    void dispose(Space& home);
+
+    /// Return number of elements
+    int size(void) const;
+    /// Return element at position \a i
+    const T& operator [](int i) const;
+    /// Return element at position \a i for modification (copies shared page)
+    T& write(int i);
+  };
+
+
+  template<class T, unsigned int lps>
+  forceinline typename CowArray<T,lps>::Page*
+  CowArray<T,lps>::Page::allocate(void) {
+    Page* p = static_cast<Page*>(heap.ralloc(sizeof(Page)));
+    p->use_cnt = 1;
+    return p;
+  }
+  template<class T, unsigned int lps>
+  forceinline typename CowArray<T,lps>::Page*
+  CowArray<T,lps>::Page::copy(void) const {
+    Page* p = allocate();
+    Heap::copy(&p->a[0],&a[0],ps);
+    return p;
+  }
+  template<class T, unsigned int lps>
+  forceinline void
+  CowArray<T,lps>::Page::release(void) {
+    if (Support::atomic_sub(use_cnt,1U) == 0U)
+      heap.rfree(this);
+  }
+
+  template<class T, unsigned int lps>
+  forceinline int
+  CowArray<T,lps>::pages(void) const {
+    return (n + ps - 1) >> lps;
+  }
+
+  template<class T, unsigned int lps>
+  forceinline
+  CowArray<T,lps>::CowArray(void) : p(NULL), n(0) {}
+
+  template<class T, unsigned int lps>
+  forceinline void
+  CowArray<T,lps>::init(Space& home, int n0, const T& t) {
+    assert((p == NULL) && (n0 >= 0));
+    n = n0;
+    p = home.alloc<Page*>(pages());
+    for (int i=pages(); i--; ) {
+      p[i] = Page::allocate();
+      for (int j=ps; j--; )
+        p[i]->a[j] = t;
+    }
+  }
+
+  template<class T, unsigned int lps>
+  forceinline void
+  CowArray<T,lps>::update(Space& home, bool, CowArray& a) {
+    n = a.n;
+    p = home.alloc<Page*>(pages());
+    for (int i=pages(); i--; ) {
+      p[i] = a.p[i];
+      (void) Support::atomic_add(p[i]->use_cnt,1U);
+    }
+  }
+
+  template<class T, unsigned int lps>
+  forceinline void
+  CowArray<T,lps>::dispose(Space& home) {
+    for (int i=pages(); i--; )
+      p[i]->release();
+    home.free<Page*>(p,pages());
+    p = NULL; n = 0;
+  }
+
+  template<class T, unsigned int lps>
+  forceinline int
+  CowArray<T,lps>::size(void) const {
+    return n;
+  }
+
+  template<class T, unsigned int lps>
+  forceinline const T&
+  CowArray<T,lps>::operator [](int i) const {
+    assert((i >= 0) && (i < n));
+    return p[i >> lps]->a[i & (ps-1)];
+  }
+
+  template<class T, unsigned int lps>
+  forceinline T&
+  CowArray<T,lps>::write(int i) {
+    assert((i >= 0) && (i < n));
+    Page*& q = p[i >> lps];
+    /*
+     * The page can only be shared more often by cloning this array,
+     * which is done by the same thread. So if the page is not shared
+     * now, it will not become shared while being written.
+     */
+    if (Support::atomic_load(q->use_cnt) > 1U) {
+      Page* c = q->copy();
+      q->release(); q = c;
+    }
+    return q->a[i & (ps-1)];
+  }
+
+}
+
+// STATISTICS: kernel-other
@@ -39,7 +39,16 @@
 
 namespace Gecode {
 
-  /// Global propagator information
+  /**
+   * \brief Global propagator information
+   *
+   * The information is shared among all spaces cloned from the same
+   * space, possibly by different threads. As long as counters are not
+   * decayed (that is, the decay factor is 1.0), failure counts are
+   * maintained by relaxed atomic operations and no mutex is involved.
+   * Only decaying counters (which require a consistent global time-stamp)
+   * are synchronized by a mutex.
+   */
   class GPI {
   public:
     /// Class for storing timed-decay value
@@ -56,6 +65,10 @@ namespace Gecode {
       /// The time-stamp
       unsigned long int t;
       //@}
+#ifdef GECODE_PROPAGATION_PROFILER
+      /// Profile information
+      PropagatorProfile profile;
+#endif
       /// Initialize
       void init(unsigned int pid, unsigned int gid);
     };
@@ -65,6 +78,10 @@ namespace Gecode {
     public:
       /// Next block
       Block* next;
+#ifdef GECODE_PROPAGATION_PROFILER
+      /// Number of entries
+      unsigned int size;
+#endif
       /// Start of counter entries
       Info c[1];
       /// Allocate block with \a n entries and previous block \a p
@@ -83,7 +100,7 @@ namespace Gecode {
       double dpow[n_dpow];
       /// The global time-stamp
       unsigned long int t;
-      /// Decay counter value
+      /// Decay counter value (requires mutex)
       void decay(Info& c);
     public:
       /// Initialize
@@ -94,11 +111,13 @@ namespace Gecode {
       void decay(double d);
       /// Return current decay factor
       double decay(void) const;
-      /// Increment counter and perform decay
+      /// Whether counters are decayed (and hence require the mutex)
+      bool decaying(void) const;
+      /// Increment counter and perform decay (requires mutex if decaying)
       void inc(Info& c);
-      /// Set failure count to \a a
+      /// Set failure count to \a a (requires mutex if decaying)
       void set(Info& c, double a);
-      /// Return counter value
+      /// Return counter value (requires mutex if decaying)
       double val(Info& c);
     };
     /// Initial smallest number of entries per block
@@ -108,7 +127,7 @@ namespace Gecode {
     /// The actual object to store the required information
     class Object : public HeapAllocated {
     public:
-      /// Mutex to synchronize globally shared access
+      /// Mutex to synchronize decaying counters
       Support::FastMutex* mutex;
       /// Pointer to timed decay manager
       Manager* manager;
@@ -124,6 +143,10 @@ namespace Gecode {
       Block* cur;
       /// Constructor
       Object(Support::FastMutex* m, Object* p=NULL);
+#ifdef GECODE_PROPAGATION_PROFILER
+      /// Record profile information of all entries with the profiler
+      void profile(void);
+#endif
     };
     /// Pointer to object, possibly marked
     void* mo;
@@ -163,18 +186,21 @@ namespace Gecode {
   forceinline void
   GPI::Info::init(unsigned int pid0, unsigned int gid0) {
     pid=pid0; gid=gid0; c=1.0; t=0UL;
+#ifdef GECODE_PROPAGATION_PROFILER
+    profile.init();
+#endif
   }
 
   forceinline void
   GPI::Manager::decay(double d0) {
-    d = d0;
-    if (d != 1.0) {
-      double p = d;
+    if (d0 != 1.0) {
+      double p = d0;
       unsigned int i=0;
       do {
-        dpow[i++]=p; p*=d;
+        dpow[i++]=p; p*=d0;
       } while (i<n_dpow);
     }
+    Support::atomic_store(d,d0);
   }
   forceinline
   GPI::Manager::Manager(void)
@@ -186,39 +212,42 @@ namespace Gecode {
   }
   forceinline double
   GPI::Manager::decay(void) const {
-    return d;
+    return Support::atomic_load(d);
+  }
+  forceinline bool
+  GPI::Manager::decaying(void) const {
+    return decay() != 1.0;
   }
   forceinline void
   GPI::Manager::decay(Info& c) {
     assert((t >= c.t) && (d != 1.0));
     unsigned int n = t - c.t;
     if (n > 0) {
-      if (n <= n_dpow) {
-        c.c *= dpow[n-1];
-      } else {
-        c.c *= pow(d,static_cast<double>(n));
-      }
+      double f = (n <= n_dpow) ? dpow[n-1] : pow(d,static_cast<double>(n));
+      // The counter might be incremented concurrently by fail without mutex
+      double v = Support::atomic_relaxed_load(c.c);
+      while (!Support::atomic_cas(c.c,v,v*f)) {}
       c.t = t;
     }
   }
   forceinline void
   GPI::Manager::inc(Info& c) {
-    if (d == 1.0) {
-      c.c += 1.0;
+    if (!decaying()) {
+      Support::atomic_add(c.c,1.0);
     } else {
       decay(c);
-      c.c += 1.0; c.t = ++t;
+      Support::atomic_add(c.c,1.0); c.t = ++t;
     }
   }
   forceinline double
   GPI::Manager::val(Info& c) {
-    if (d != 1.0)
+    if (decaying())
       decay(c);
-    return c.c;
+    return Support::atomic_relaxed_load(c.c);
   }
   forceinline void
   GPI::Manager::set(Info& c, double a) {
-    c.c = a;
+    Support::atomic_relaxed_store(c.c,a);
   }
 
 
@@ -231,6 +260,9 @@ namespace Gecode {
     Block* b = static_cast<Block*>(heap.ralloc(sizeof(Block)+
                                                (n-1)*sizeof(Info)));
     b->next = p;
+#ifdef GECODE_PROPAGATION_PROFILER
+    b->size = n;
+#endif
     return b;
   }
 
@@ -245,6 +277,20 @@ namespace Gecode {
     }
   }
 
+#ifdef GECODE_PROPAGATION_PROFILER
+  forceinline void
+  GPI::Object::profile(void) {
+    // Entries are allocated downwards, only the current block has free ones
+    unsigned int f = free;
+    for (Block* b = cur; b != NULL; b = b->next) {
+      for (unsigned int i=f; i<b->size; i++)
+        if (b->c[i].profile.propagate > 0ULL)
+          profiler.record(b->c[i].gid,b->c[i].profile);
+      f = 0U;
+    }
+  }
+#endif
+
   forceinline GPI::Object*
   GPI::object(void) const {
     return static_cast<Object*>(Support::funmark(mo));
@@ -272,19 +318,22 @@ namespace Gecode {
   forceinline
   GPI::GPI(const GPI& gpi) {
     global(gpi.mo);
-    Object* o = object();
-    o->mutex->acquire();
-    o->use_cnt++;
-    o->mutex->release();
+    (void) Support::atomic_add(object()->use_cnt,1U);
   }
 
   forceinline void
   GPI::dispose(void) {
-    Support::FastMutex* m = object()->mutex;
-    m->acquire();
     Object* c = object();
+    Support::FastMutex* m = c->mutex;
     Manager* manager = c->manager;
-    while ((c != NULL) && (--c->use_cnt == 0)) {
+    /*
+     * An object is deleted by the single thread that drops its last use,
+     * which then also owns the use of its parent object.
+     */
+    while ((c != NULL) && (Support::atomic_sub(c->use_cnt,1U) == 0)) {
+#ifdef GECODE_PROPAGATION_PROFILER
+      c->profile();
+#endif
       // Delete all blocks for c
       Block* b = c->cur;
       while (b != NULL) {
@@ -295,7 +344,6 @@ namespace Gecode {
       Object* d = c; c = c->parent;
       delete d;
     }
-    m->release();
     // All objects are deleted, so also delete mutex and manager
     if (c == NULL) {
       delete manager;
@@ -310,38 +358,48 @@ namespace Gecode {
 
   forceinline void
   GPI::fail(Info& c) {
-    Support::FastMutex& m = *object()->mutex;
-    m.acquire();
-    object()->manager->inc(c);
-    m.release();
+    Object* o = object();
+    if (o->manager->decaying()) {
+      Support::FastMutex& m = *o->mutex;
+      m.acquire();
+      o->manager->inc(c);
+      m.release();
+    } else {
+      Support::atomic_add(c.c,1.0);
+    }
   }
 
   forceinline void
   GPI::set(Info& c, double a) {
-    Support::FastMutex& m = *object()->mutex;
-    m.acquire();
-    object()->manager->set(c,a);
-    m.release();
+    Object* o = object();
+    if (o->manager->decaying()) {
+      Support::FastMutex& m = *o->mutex;
+      m.acquire();
+      o->manager->set(c,a);
+      m.release();
+    } else {
+      Support::atomic_relaxed_store(c.c,a);
+    }
   }
 
   forceinline double
   GPI::afc(Info& c) {
-    Support::FastMutex& m = *object()->mutex;
+    Object* o = object();
     double d;
-    m.acquire();
-    d = object()->manager->val(c);
-    m.release();
+    if (o->manager->decaying()) {
+      Support::FastMutex& m = *o->mutex;
+      m.acquire();
+      d = o->manager->val(c);
+      m.release();
+    } else {
+      d = Support::atomic_relaxed_load(c.c);
+    }
     return d;
   }
 
   forceinline double
   GPI::decay(void) const {
-    Support::FastMutex& m = *object()->mutex;
-    double d;
-    m.acquire();
-    d = object()->manager->decay();
-    m.release();
-    return d;
+    return object()->manager->decay();
   }
 
   forceinline void
@@ -42,6 +42,10 @@ namespace Gecode {
 
   /**
    * \brief Parameters defining memory management policy for spaces
+   *
+   * The parameters that can be changed at runtime (see MemoryPolicy)
+   * only define the default values.
+   *
    * \ingroup FuncMemSpace
    */
   namespace MemoryConfig {
@@ -80,6 +84,32 @@ namespace Gecode {
      */
     const int hcsz_dec_ratio = 8;
 
+    /**
+     * \brief Binary logarithm of size of smallest size class for heap chunk pools
+     *
+     * Heap chunks that are not cached by spaces any longer are kept in
+     * a pool per thread, so that they can be reused by other spaces
+     * (and search engines) running in the same thread. Only chunks
+     * whose size is a power of two are pooled, chunks of equal size form
+     * a size class.
+     */
+    const unsigned int hcp_sc_min = 10;
+    /**
+     * \brief Number of size classes for heap chunk pools
+     */
+    const unsigned int hcp_n_sc = 11;
+    /**
+     * \brief Default high-water mark for each size class of a heap chunk pool
+     *
+     * If a size class contains that many heap chunks, further chunks
+     * of that size are released to the operating system.
+     */
+    const unsigned int hcp_hwm = 64;
+    /**
+     * \brief Default for maximal memory (in bytes) cached by a heap chunk pool
+     */
+    const size_t hcp_max = 4 * 1024 * 1024;
+
     /**
      * \brief Unit size for free lists
      *
@@ -152,6 +182,82 @@ namespace Gecode {
     }
 
   }
+
+  /**
+   * \brief Memory management policy for spaces
+   *
+   * A policy is shared by a space and all its clones that share memory
+   * with it (see Space::clone), a non-shared clone copies the policy.
+   * The initial values are taken from MemoryConfig and have the same
+   * meaning. Values that are out of range (for example, a maximal heap
+   * chunk size that is smaller than the minimal size) are adjusted when
+   * the policy is set for a space. Heap chunk sizes are adjusted to
+   * powers of two.
+   *
+   * \ingroup FuncMemSpace
+   */
+  class MemoryPolicy {
+  public:
+    /// Minimal size of a heap chunk requested from the OS
+    size_t hcsz_min;
+    /// Maximal size of a heap chunk requested from the OS
+    size_t hcsz_max;
+    /// Increment ratio for chunk size
+    unsigned int hcsz_inc_ratio;
+    /// Decrement ratio for chunk size
+    unsigned int hcsz_dec_ratio;
+    /// Number of free lists elements to allocate (at least two)
+    unsigned int fl_refill;
+    /// Size of region area
+    size_t region_area_size;
+    /**
+     * \brief Whether chunk sizes are learned from the original space
+     *
+     * If true, the initial heap chunk size of a clone is chosen such
+     * that the first chunk can hold as much memory as the original
+     * space has requested (limited by the largest size class of heap
+     * chunk pools). Hence, cloning a large space requires a single
+     * chunk rather than many chunks of growing size.
+     */
+    bool adaptive;
+    /// Initialize with default values from MemoryConfig
+    MemoryPolicy(void);
+    /// Adjust values that are out of range
+    void normalize(void);
+  };
+
+  forceinline
+  MemoryPolicy::MemoryPolicy(void)
+    : hcsz_min(MemoryConfig::hcsz_min), hcsz_max(MemoryConfig::hcsz_max),
+      hcsz_inc_ratio(MemoryConfig::hcsz_inc_ratio),
+      hcsz_dec_ratio(MemoryConfig::hcsz_dec_ratio),
+      fl_refill(MemoryConfig::fl_refill),
+      region_area_size(MemoryConfig::region_area_size),
+      adaptive(false) {}
+
+  forceinline void
+  MemoryPolicy::normalize(void) {
+    /*
+     * Chunk sizes are doubled starting from the minimal size and heap
+     * chunk pools only keep chunks whose size is a power of two: round
+     * the minimal size up and the maximal size down to a power of two.
+     */
+    size_t s = MemoryConfig::hcsz_min;
+    while ((s < hcsz_min) && ((s << 1) > s))
+      s <<= 1;
+    hcsz_min = s;
+    while (((s << 1) <= hcsz_max) && ((s << 1) > s))
+      s <<= 1;
+    hcsz_max = s;
+    if (hcsz_inc_ratio < 1U)
+      hcsz_inc_ratio = 1U;
+    if (hcsz_dec_ratio < 1U)
+      hcsz_dec_ratio = 1U;
+    if (fl_refill < 2U)
+      fl_refill = 2U;
+    MemoryConfig::align(region_area_size);
+  }
+
 }
 
 // STATISTICS: kernel-memory
@@ -39,6 +39,95 @@
 
 namespace Gecode {
 
+#ifdef GECODE_THREAD_LOCAL
+  /// The heap chunk pool of the current thread (created on demand)
+  static GECODE_THREAD_LOCAL HeapChunkPool* hcp = NULL;
+
+  /*
+   * The pool of a thread is deleted when the thread exits by a
+   * destructor registered with thread-specific storage.
+   */
+#if defined(GECODE_THREADS_PTHREADS)
+
+  /// Key with destructor for the pools of threads
+  static pthread_key_t hcp_key;
+  /// Create the key only once
+  static pthread_once_t hcp_key_once = PTHREAD_ONCE_INIT;
+  /// Result of creating the key
+  static int hcp_key_error = 0;
+
+  /// Delete pool \a p of exiting thread
+  static void
+  hcp_delete(void* p) {
+    delete static_cast<HeapChunkPool*>(p);
+    hcp = NULL;
+  }
+  /// Create key
+  static void
+  hcp_key_create(void) {
+    hcp_key_error = pthread_key_create(&hcp_key, hcp_delete);
+  }
+  /// Register pool \a p for deletion when the current thread exits
+  static void
+  hcp_register(HeapChunkPool* p) {
+    if ((pthread_once(&hcp_key_once, hcp_key_create) != 0) ||
+        (hcp_key_error != 0) ||
+        (pthread_setspecific(hcp_key, p) != 0))
+      throw OperatingSystemError
+        ("HeapChunkPool::current[pthread_setspecific]");
+  }
+
+#elif defined(GECODE_THREADS_WINDOWS)
+
+  /// Delete pool \a p of exiting thread
+  static void WINAPI
+  hcp_delete(void* p) {
+    delete static_cast<HeapChunkPool*>(p);
+    hcp = NULL;
+  }
+  /// Return index with destructor for the pools of threads
+  static DWORD
+  hcp_index(void) {
+    static DWORD i = FlsAlloc(hcp_delete);
+    return i;
+  }
+  /// Register pool \a p for deletion when the current thread exits
+  static void
+  hcp_register(HeapChunkPool* p) {
+    if ((hcp_index() == FLS_OUT_OF_INDEXES) ||
+        !FlsSetValue(hcp_index(), p))
+      throw OperatingSystemError
+        ("HeapChunkPool::current[FlsSetValue]");
+  }
+
+#else
+
+  /// Threads are not supported: the pool is never deleted
+  static void
+  hcp_register(HeapChunkPool*) {}
+
+#endif
+#endif
+
+  HeapChunkPool*
+  HeapChunkPool::current(void) {
+#ifdef GECODE_THREAD_LOCAL
+    if (hcp == NULL) {
+      HeapChunkPool* p = new HeapChunkPool;
+      try {
+        hcp_register(p);
+      } catch (...) {
+        delete p;
+        throw;
+      }
+      hcp = p;
+    }
+    return hcp;
+#else
+    return NULL;
+#endif
+  }
+
   void
   MemoryManager::alloc_refill(SharedMemory* sm, size_t sz) {
     // Try to reuse the not used memory
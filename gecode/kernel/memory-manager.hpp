@@ -62,18 +62,92 @@ namespace Gecode {
 
   class Region;
 
+  /**
+   * \brief Pool of heap chunks for a thread
+   *
+   * Each thread has its own pool that caches heap chunks released by
+   * spaces. As threads used by search engines are pooled as well, the
+   * chunks are reused by all spaces and all search engines that run in
+   * the same thread without any synchronization.
+   *
+   * Chunks are organized in size classes (see
+   * MemoryConfig::hcp_sc_min and MemoryConfig::hcp_n_sc). A chunk is
+   * released to the operating system if its size class has reached the
+   * high-water mark or if the pool would exceed its maximal size.
+   *
+   * \ingroup FuncMemSpace
+   */
+  class HeapChunkPool {
+  private:
+    /// A size class
+    class SizeClass {
+    public:
+      /// Number of chunks
+      unsigned int n;
+      /// List of chunks
+      HeapChunk* hc;
+    };
+    /// The size classes
+    SizeClass sc[MemoryConfig::hcp_n_sc];
+    /// Amount of memory (in bytes) currently held
+    size_t _size;
+    /// High-water mark for size classes
+    unsigned int _hwm;
+    /// Maximal amount of memory (in bytes) to be held
+    size_t _max;
+    /// Return size class for size \a s (or -1 if chunk cannot be pooled)
+    static int sz2sc(size_t s);
+  public:
+    /// Initialize with default limits
+    HeapChunkPool(void);
+    /**
+     * \brief Return pool for the current thread
+     *
+     * Returns NULL if thread-local pools are not supported.
+     */
+    GECODE_KERNEL_EXPORT static HeapChunkPool* current(void);
+    /// Return heap chunk of size \a s (NULL if none available)
+    HeapChunk* alloc(size_t s);
+    /// Cache heap chunk \a hc or release it to the operating system
+    void free(HeapChunk* hc);
+    /// Release all chunks to the operating system
+    void flush(void);
+    /// Set high-water mark for size classes to \a n
+    void hwm(unsigned int n);
+    /// Return high-water mark for size classes
+    unsigned int hwm(void) const;
+    /// Set maximal amount of memory (in bytes) to be held to \a s
+    void max(size_t s);
+    /// Return maximal amount of memory (in bytes) to be held
+    size_t max(void) const;
+    /// Return amount of memory (in bytes) currently held
+    size_t size(void) const;
+    /// Release all chunks
+    ~HeapChunkPool(void);
+    /// Allocate memory from heap
+    static void* operator new(size_t s);
+    /// Free memory allocated from heap
+    static void  operator delete(void* p);
+  };
+
   /// Shared object for several memory areas
   class SharedMemory {
     friend class Region;
   private:
     /// How many spaces use this shared memory object
     unsigned int use_cnt;
+    /// The memory management policy
+    MemoryPolicy mp;
     /// The components for the shared region area
     struct {
       /// Amount of free memory
       size_t free;
+      /// Size of the memory area
+      size_t size;
+      /// Size of the memory area allocated with this object
+      size_t capacity;
       /// The actual memory area (allocated from top to bottom)
-      double area[MemoryConfig::region_area_size / sizeof(double)];
+      double* area;
     } region;
     /// The components for shared heap memory
     struct {
@@ -82,10 +156,14 @@ namespace Gecode {
       /// A list of cached heap chunks
       HeapChunk* hc;
     } heap;
+    /// Release heap chunk \a hc to thread pool or operating system
+    static void heap_release(HeapChunk* hc);
+    /// Return memory area for region allocated with this object
+    double* inline_area(void);
   public:
-    /// Initialize
-    SharedMemory(void);
-    /// Flush all cached memory
+    /// Initialize with policy \a p (memory for region area must be allocated by new)
+    SharedMemory(const MemoryPolicy& p);
+    /// Flush all cached memory (release to the operating system)
     void flush(void);
     /// Destructor
     ~SharedMemory(void);
@@ -94,6 +172,13 @@ namespace Gecode {
     /// Return memory chunk if available
     bool region_alloc(size_t s, void*& p);
     //@}
+    /// \name Memory management policy
+    //@
+    /// Return policy
+    const MemoryPolicy& policy(void) const;
+    /// Set policy to \a p (requires that the region area is not in use)
+    void policy(const MemoryPolicy& p);
+    //@}
     /// \name Heap management
     //@
     /// Return heap chunk, preferable of size \a s, but at least of size \a l
@@ -105,8 +190,8 @@ namespace Gecode {
     SharedMemory* copy(bool share);
     /// Release by one space
     bool release(void);
-    /// Allocate memory from heap
-    static void* operator new(size_t s);
+    /// Allocate memory from heap, including \a a bytes for region area
+    static void* operator new(size_t s, size_t a);
     /// Free memory allocated from heap
     static void  operator delete(void* p);
   };
@@ -146,6 +231,8 @@ namespace Gecode {
     MemoryManager(SharedMemory* sm, MemoryManager& mm, size_t s_sub);
     /// Release all allocated heap chunks
     void release(SharedMemory* sm);
+    /// Adapt to policy of shared memory \a sm
+    void policy(SharedMemory* sm);
 
   private:
     size_t     cur_hcsz;  ///< Current heap chunk size
@@ -194,25 +281,142 @@ namespace Gecode {
 
 
   /*
-   * Shared memory area
+   * Heap chunk pool
    *
    */
 
   forceinline void*
-  SharedMemory::operator new(size_t s) {
+  HeapChunkPool::operator new(size_t s) {
     return Gecode::heap.ralloc(s);
   }
   forceinline void
+  HeapChunkPool::operator delete(void* p) {
+    Gecode::heap.rfree(p);
+  }
+  forceinline
+  HeapChunkPool::HeapChunkPool(void)
+    : _size(0), _hwm(MemoryConfig::hcp_hwm), _max(MemoryConfig::hcp_max) {
+    for (unsigned int i=0; i<MemoryConfig::hcp_n_sc; i++) {
+      sc[i].n = 0; sc[i].hc = NULL;
+    }
+  }
+  forceinline int
+  HeapChunkPool::sz2sc(size_t s) {
+    size_t c = static_cast<size_t>(1) << MemoryConfig::hcp_sc_min;
+    for (unsigned int i=0; i<MemoryConfig::hcp_n_sc; i++, c <<= 1)
+      if (s == c)
+        return static_cast<int>(i);
+    return -1;
+  }
+  forceinline HeapChunk*
+  HeapChunkPool::alloc(size_t s) {
+    int i = sz2sc(s);
+    if ((i < 0) || (sc[i].hc == NULL))
+      return NULL;
+    HeapChunk* hc = sc[i].hc;
+    sc[i].hc = static_cast<HeapChunk*>(hc->next);
+    sc[i].n--;
+    _size -= s;
+    return hc;
+  }
+  forceinline void
+  HeapChunkPool::free(HeapChunk* hc) {
+    int i = sz2sc(hc->size);
+    if ((i < 0) || (sc[i].n >= _hwm) || (_size + hc->size > _max)) {
+      Gecode::heap.rfree(hc);
+    } else {
+      hc->next = sc[i].hc; sc[i].hc = hc;
+      sc[i].n++;
+      _size += hc->size;
+    }
+  }
+  forceinline void
+  HeapChunkPool::flush(void) {
+    for (unsigned int i=0; i<MemoryConfig::hcp_n_sc; i++) {
+      while (sc[i].hc != NULL) {
+        HeapChunk* hc = sc[i].hc;
+        sc[i].hc = static_cast<HeapChunk*>(hc->next);
+        Gecode::heap.rfree(hc);
+      }
+      sc[i].n = 0;
+    }
+    _size = 0;
+  }
+  forceinline void
+  HeapChunkPool::hwm(unsigned int n) {
+    _hwm = n;
+  }
+  forceinline unsigned int
+  HeapChunkPool::hwm(void) const {
+    return _hwm;
+  }
+  forceinline void
+  HeapChunkPool::max(size_t s) {
+    _max = s;
+  }
+  forceinline size_t
+  HeapChunkPool::max(void) const {
+    return _max;
+  }
+  forceinline size_t
+  HeapChunkPool::size(void) const {
+    return _size;
+  }
+  forceinline
+  HeapChunkPool::~HeapChunkPool(void) {
+    flush();
+  }
+
+
+  /*
+   * Shared memory area
+   *
+   */
+
+  forceinline void*
+  SharedMemory::operator new(size_t s, size_t a) {
+    MemoryConfig::align(s);
+    return Gecode::heap.ralloc(s+a);
+  }
+  forceinline void
   SharedMemory::operator delete(void* p) {
     Gecode::heap.rfree(p);
   }
+  forceinline double*
+  SharedMemory::inline_area(void) {
+    size_t s = sizeof(SharedMemory);
+    MemoryConfig::align(s);
+    return ptr_cast<double*>(ptr_cast<char*>(this) + s);
+  }
   forceinline
-  SharedMemory::SharedMemory(void)
-    : use_cnt(1) {
-    region.free = MemoryConfig::region_area_size;
+  SharedMemory::SharedMemory(const MemoryPolicy& p)
+    : use_cnt(1), mp(p) {
+    region.free = region.size = region.capacity = mp.region_area_size;
+    region.area = inline_area();
     heap.n_hc = 0;
     heap.hc = NULL;
   }
+  forceinline const MemoryPolicy&
+  SharedMemory::policy(void) const {
+    return mp;
+  }
+  forceinline void
+  SharedMemory::policy(const MemoryPolicy& p) {
+    mp = p;
+    mp.normalize();
+    if (mp.region_area_size != region.size) {
+      // The region area must not be in use
+      assert(region.free == region.size);
+      if (region.area != inline_area())
+        Gecode::heap.rfree(region.area);
+      if (mp.region_area_size <= region.capacity)
+        region.area = inline_area();
+      else
+        region.area = static_cast<double*>
+          (Gecode::heap.ralloc(mp.region_area_size));
+      region.free = region.size = mp.region_area_size;
+    }
+  }
   forceinline void
   SharedMemory::flush(void) {
     heap.n_hc = 0;
@@ -222,9 +426,24 @@ namespace Gecode {
       Gecode::heap.rfree(hc);
     }
   }
+  forceinline void
+  SharedMemory::heap_release(HeapChunk* hc) {
+    if (HeapChunkPool* p = HeapChunkPool::current())
+      p->free(hc);
+    else
+      Gecode::heap.rfree(hc);
+  }
   forceinline
   SharedMemory::~SharedMemory(void) {
-    flush();
+    if (region.area != inline_area())
+      Gecode::heap.rfree(region.area);
+    // Keep cached chunks for other spaces in the same thread
+    heap.n_hc = 0;
+    while (heap.hc != NULL) {
+      HeapChunk* hc = heap.hc;
+      heap.hc = static_cast<HeapChunk*>(hc->next);
+      heap_release(hc);
+    }
   }
   forceinline SharedMemory*
   SharedMemory::copy(bool share) {
@@ -232,7 +451,7 @@ namespace Gecode {
       use_cnt++;
       return this;
     } else {
-      return new SharedMemory();
+      return new (mp.region_area_size) SharedMemory(mp);
     }
   }
   forceinline bool
@@ -245,7 +464,7 @@ namespace Gecode {
     if (s > region.free)
       return false;
     region.free -= s;
-    p = ptr_cast<char*>(&region.area[0]) + region.free;
+    p = ptr_cast<char*>(region.area) + region.free;
     return true;
   }
   forceinline HeapChunk*
@@ -254,12 +473,17 @@ namespace Gecode {
       heap.n_hc--;
       HeapChunk* hc = heap.hc;
       heap.hc = static_cast<HeapChunk*>(hc->next);
-      Gecode::heap.rfree(hc);
+      heap_release(hc);
     }
     if (heap.hc == NULL) {
       assert(heap.n_hc == 0);
-      HeapChunk* hc = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
-      hc->size = s;
+      assert(s >= l);
+      HeapChunkPool* p = HeapChunkPool::current();
+      HeapChunk* hc = (p != NULL) ? p->alloc(s) : NULL;
+      if (hc == NULL) {
+        hc = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
+        hc->size = s;
+      }
       return hc;
     } else {
       heap.n_hc--;
@@ -271,7 +495,7 @@ namespace Gecode {
   forceinline void
   SharedMemory::heap_free(HeapChunk* hc) {
     if (heap.n_hc == MemoryConfig::n_hc_cache) {
-      Gecode::heap.rfree(hc);
+      heap_release(hc);
     } else {
       heap.n_hc++;
       hc->next = heap.hc; heap.hc = hc;
@@ -343,10 +567,11 @@ namespace Gecode {
 
   forceinline void
   MemoryManager::alloc_fill(SharedMemory* sm, size_t sz, bool first) {
+    const MemoryPolicy& mp = sm->policy();
     // Adjust current heap chunk size
-    if (((requested > MemoryConfig::hcsz_inc_ratio*cur_hcsz) ||
+    if (((requested > mp.hcsz_inc_ratio*cur_hcsz) ||
          (sz > cur_hcsz)) &&
-        (cur_hcsz < MemoryConfig::hcsz_max) &&
+        (cur_hcsz < mp.hcsz_max) &&
         !first) {
       cur_hcsz <<= 1;
     }
@@ -376,7 +601,7 @@ namespace Gecode {
 
   forceinline
   MemoryManager::MemoryManager(SharedMemory* sm)
-    : cur_hcsz(MemoryConfig::hcsz_min), requested(0), slack(NULL) {
+    : cur_hcsz(sm->policy().hcsz_min), requested(0), slack(NULL) {
     alloc_fill(sm,cur_hcsz,true);
     for (size_t i = MemoryConfig::fl_size_max-MemoryConfig::fl_size_min+1;
          i--; )
@@ -387,11 +612,27 @@ namespace Gecode {
   MemoryManager::MemoryManager(SharedMemory* sm, MemoryManager& mm,
                                size_t s_sub)
     : cur_hcsz(mm.cur_hcsz), requested(0), slack(NULL) {
+    const MemoryPolicy& mp = sm->policy();
     MemoryConfig::align(s_sub);
-    if ((mm.requested < MemoryConfig::hcsz_dec_ratio*mm.cur_hcsz) &&
-        (cur_hcsz > MemoryConfig::hcsz_min) &&
-        (s_sub*2 < cur_hcsz))
+    if (mp.adaptive) {
+      /*
+       * Use the largest chunk size not exceeding the memory requested by
+       * the original space: as the first chunk also holds the
+       * subscriptions, it is at least twice as large. The size is
+       * limited by the policy and by the largest size class of pools.
+       */
+      size_t l = std::min(mp.hcsz_max,
+                          static_cast<size_t>(1) <<
+                          (MemoryConfig::hcp_sc_min +
+                           MemoryConfig::hcp_n_sc - 2));
+      cur_hcsz = mp.hcsz_min;
+      while ((2*cur_hcsz <= mm.requested) && (2*cur_hcsz <= l))
+        cur_hcsz <<= 1;
+    } else if ((mm.requested < mp.hcsz_dec_ratio*mm.cur_hcsz) &&
+               (cur_hcsz > mp.hcsz_min) &&
+               (s_sub*2 < cur_hcsz)) {
       cur_hcsz >>= 1;
+    }
     alloc_fill(sm,cur_hcsz+s_sub,true);
     // Skip the memory area at the beginning for subscriptions
     lsz   -= s_sub;
@@ -401,6 +642,15 @@ namespace Gecode {
       fl[i] = NULL;
   }
 
+  forceinline void
+  MemoryManager::policy(SharedMemory* sm) {
+    const MemoryPolicy& mp = sm->policy();
+    if (cur_hcsz < mp.hcsz_min)
+      cur_hcsz = mp.hcsz_min;
+    else if (cur_hcsz > mp.hcsz_max)
+      cur_hcsz = mp.hcsz_max;
+  }
+
   forceinline void
   MemoryManager::release(SharedMemory* sm) {
     // Release all allocated heap chunks
@@ -496,14 +746,14 @@ namespace Gecode {
         ptr_cast<FreeList*>(block)->next(NULL);
       } while (m != NULL);
     } else {
-      char* block = static_cast<char*>(alloc(sm,MemoryConfig::fl_refill*sz));
+      int n = static_cast<int>(sm->policy().fl_refill);
+      char* block = static_cast<char*>(alloc(sm,n*sz));
       fl[sz2i(sz)] = ptr_cast<FreeList*>(block);
-      int i = MemoryConfig::fl_refill-2;
+      int i = n-2;
       do {
         ptr_cast<FreeList*>(block+i*sz)->next(ptr_cast<FreeList*>(block+(i+1)*sz));
       } while (--i >= 0);
-      ptr_cast<FreeList*>(block+
-                          (MemoryConfig::fl_refill-1)*sz)->next
+      ptr_cast<FreeList*>(block+(n-1)*sz)->next
         (ptr_cast<FreeList*>(NULL));
     }
   }
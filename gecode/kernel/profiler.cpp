@@ -0,0 +1,171 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+
+#ifdef GECODE_PROPAGATION_PROFILER
+
+#ifdef __GNUC__
+#include <cxxabi.h>
+#endif
+
+namespace Gecode {
+
+  Profiler profiler;
+
+  namespace {
+
+    /// Sort entries by decreasing number of cycles
+    template<class Entry>
+    class ByCycles {
+    public:
+      bool operator ()(const Entry* x, const Entry* y) const {
+        return x->p.cycles > y->p.cycles;
+      }
+    };
+
+    /// Print name \a n (demangled if possible) escaping quotes
+    void
+    name(std::ostream& os, const char* n) {
+      char* d = NULL;
+#ifdef __GNUC__
+      int s;
+      d = abi::__cxa_demangle(n,NULL,NULL,&s);
+      if (s != 0)
+        d = NULL;
+#endif
+      for (const char* c = (d != NULL) ? d : n; *c; c++) {
+        if ((*c == '"') || (*c == '\\'))
+          os << '\\';
+        os << *c;
+      }
+      free(d);
+    }
+
+  }
+
+  Profiler::Profiler(void) : n(0U) {
+    for (unsigned int i=0U; i<n_buckets; i++)
+      bucket[i] = NULL;
+  }
+
+  void
+  Profiler::record(unsigned int gid, const PropagatorProfile& p) {
+    assert(p.name != NULL);
+    unsigned int h = gid;
+    for (const char* c = p.name; *c; c++)
+      h = 31U*h + static_cast<unsigned char>(*c);
+    Support::Lock l(m);
+    Entry** b = &bucket[h % n_buckets];
+    for (Entry* e = *b; e != NULL; e = e->next)
+      if ((e->gid == gid) &&
+          ((e->p.name == p.name) || (strcmp(e->p.name,p.name) == 0))) {
+        e->p.add(p);
+        return;
+      }
+    Entry* e = new Entry;
+    e->gid = gid; e->p = p; e->next = *b; *b = e;
+    n++;
+  }
+
+  void
+  Profiler::reset(void) {
+    Support::Lock l(m);
+    for (unsigned int i=0U; i<n_buckets; i++) {
+      Entry* e = bucket[i];
+      while (e != NULL) {
+        Entry* d = e; e = e->next;
+        delete d;
+      }
+      bucket[i] = NULL;
+    }
+    n = 0U;
+  }
+
+  void
+  Profiler::print(std::ostream& os, ProfileFormat pf) {
+    Support::Lock l(m);
+    Entry** es = heap.alloc<Entry*>(n);
+    {
+      unsigned int k=0U;
+      for (unsigned int i=0U; i<n_buckets; i++)
+        for (Entry* e = bucket[i]; e != NULL; e = e->next)
+          es[k++] = e;
+      assert(k == n);
+    }
+    ByCycles<Entry> bc;
+    Support::quicksort(es,static_cast<int>(n),bc);
+    if (pf == PF_CSV) {
+      os << "propagator,group,propagate,nofix,subsumed,failed,cycles"
+         << std::endl;
+      for (unsigned int i=0U; i<n; i++) {
+        const PropagatorProfile& p = es[i]->p;
+        os << '"'; name(os,p.name); os << '"' << ','
+           << es[i]->gid << ','
+           << p.propagate << ',' << p.nofix << ','
+           << p.subsumed << ',' << p.failed << ','
+           << p.cycles << std::endl;
+      }
+    } else {
+      os << '[';
+      for (unsigned int i=0U; i<n; i++) {
+        const PropagatorProfile& p = es[i]->p;
+        if (i > 0U)
+          os << ',';
+        os << std::endl
+           << "  {\"propagator\": \""; name(os,p.name); os << "\", "
+           << "\"group\": " << es[i]->gid << ", "
+           << "\"propagate\": " << p.propagate << ", "
+           << "\"nofix\": " << p.nofix << ", "
+           << "\"subsumed\": " << p.subsumed << ", "
+           << "\"failed\": " << p.failed << ", "
+           << "\"cycles\": " << p.cycles << "}";
+      }
+      os << std::endl << ']' << std::endl;
+    }
+    heap.free<Entry*>(es,n);
+  }
+
+  Profiler::~Profiler(void) {
+    reset();
+  }
+
+}
+
+#endif
+
+// STATISTICS: kernel-other
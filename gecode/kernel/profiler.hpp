@@ -0,0 +1,158 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifdef GECODE_PROPAGATION_PROFILER
+
+namespace Gecode {
+
+  /**
+   * \defgroup TaskProfile Propagation profiling
+   *
+   * If Gecode is configured with --enable-propagation-profiler, the
+   * kernel records for each propagator how often it has been executed,
+   * how often it did not report a fixpoint, how often it has been
+   * subsumed or failed, and how many processor cycles it spent.
+   *
+   * The information is recorded with the global propagator information
+   * and is hence shared by all clones of a space. When the last space
+   * sharing the information is deleted, the information is summarized
+   * in the global profiler Gecode::profiler by propagator class and
+   * propagator group (that is, by posting site).
+   *
+   * \ingroup TaskTrace
+   */
+
+  /**
+   * \brief Profile information for propagation
+   * \ingroup TaskProfile
+   */
+  class PropagatorProfile {
+  public:
+    /// Name of propagator class (NULL if not yet known)
+    const char* name;
+    /// Number of executions
+    unsigned long long int propagate;
+    /// Number of executions that did not report a fixpoint
+    unsigned long long int nofix;
+    /// Number of subsumptions
+    unsigned long long int subsumed;
+    /// Number of failures
+    unsigned long long int failed;
+    /// Number of processor cycles spent during execution
+    unsigned long long int cycles;
+    /// Initialize with no information
+    void init(void);
+    /// Add information from \a p
+    void add(const PropagatorProfile& p);
+  };
+
+  /**
+   * \brief Formats for printing profile information
+   * \ingroup TaskProfile
+   */
+  enum ProfileFormat {
+    PF_CSV, ///< Comma separated values, one line per entry
+    PF_JSON ///< JSON array with one object per entry
+  };
+
+  /**
+   * \brief Profiler summarizing propagation profile information
+   *
+   * Entries are kept by propagator class and propagator group.
+   *
+   * \ingroup TaskProfile
+   */
+  class GECODE_KERNEL_EXPORT Profiler {
+  private:
+    /// Entry for a propagator class and propagator group
+    class Entry : public HeapAllocated {
+    public:
+      /// Propagator group identifier
+      unsigned int gid;
+      /// The profile information
+      PropagatorProfile p;
+      /// Next entry in the same bucket
+      Entry* next;
+    };
+    /// Number of hash buckets
+    static const unsigned int n_buckets = 64;
+    /// Mutex for synchronizing access
+    Support::Mutex m;
+    /// The hash buckets
+    Entry* bucket[n_buckets];
+    /// Number of entries
+    unsigned int n;
+  public:
+    /// Initialize
+    Profiler(void);
+    /// Add profile information \a p for propagator group \a gid
+    void record(unsigned int gid, const PropagatorProfile& p);
+    /// Discard all recorded information
+    void reset(void);
+    /**
+     * \brief Print recorded information to \a os in format \a pf
+     *
+     * Entries are printed by decreasing number of cycles.
+     */
+    void print(std::ostream& os, ProfileFormat pf=PF_CSV);
+    /// Destructor
+    ~Profiler(void);
+  };
+
+  /**
+   * \brief The global propagation profiler
+   * \ingroup TaskProfile
+   */
+  extern GECODE_KERNEL_EXPORT Profiler profiler;
+
+
+  forceinline void
+  PropagatorProfile::init(void) {
+    name=NULL; propagate=nofix=subsumed=failed=cycles=0ULL;
+  }
+  forceinline void
+  PropagatorProfile::add(const PropagatorProfile& p) {
+    propagate += p.propagate; nofix += p.nofix;
+    subsumed += p.subsumed; failed += p.failed;
+    cycles += p.cycles;
+  }
+
+}
+
+#endif
+
+// STATISTICS: kernel-other
@@ -112,6 +112,10 @@ namespace Gecode { namespace Search {
 
     /// Minimal number of open nodes for stealing
     const unsigned int steal_limit = 3;
+    /// Number of unsuccessful attempts to find work before backing off
+    const unsigned int steal_spin = 64;
+    /// Delay in milliseconds for an idle worker after backing off
+    const unsigned int steal_backoff = 1;
     /// Initial delay in milliseconds for all but first worker thread
     const unsigned int initial_delay = 5;
 
@@ -125,6 +129,13 @@ namespace Gecode { namespace Search {
 
     /// Depth limit for no-good generation during search
     const unsigned int nogoods_limit = 128;
+    /// Decay factor for the activity of no-goods at each restart
+    const double nogoods_decay = 0.5;
+
+    /// Depth limit for decomposition into subproblems
+    const unsigned int eps_depth = 64;
+    /// Number of subproblems per process for distributed search
+    const unsigned int eps = 30;
   }
 
 }}
@@ -402,6 +413,61 @@ namespace Gecode { namespace Search {
 
 #include <gecode/search/cutoff.hpp>
 
+namespace Gecode { namespace Search {
+
+  /**
+   * \brief Subproblems for embarrassingly parallel search
+   *
+   * A subproblem is a node of the search tree that is described by the
+   * alternatives and the archived choices leading from the root to it.
+   * As a subproblem only refers to branchers of the root space, it can
+   * be recomputed from any copy of the root space (also in a different
+   * process) and the subproblems can be stored, for example to resume
+   * or to split a batch of subproblems.
+   *
+   * \ingroup TaskModelSearch
+   */
+  class GECODE_SEARCH_EXPORT Subproblems {
+  protected:
+    /// The subproblems
+    Support::DynamicArray<Archive,Heap> sp;
+    /// Number of subproblems
+    int n;
+  public:
+    /// Initialize without subproblems
+    Subproblems(void);
+    /// Initialize from archive \a e (as created by archive())
+    Subproblems(Archive& e);
+    /**
+     * \brief Decompose \a s into at least \a m subproblems
+     *
+     * The search tree of \a s is expanded level by level until there
+     * are at least \a m subproblems or depth \a d has been reached.
+     * Failed nodes are dropped, hence all subproblems are consistent
+     * after propagation. The subproblems are ordered from left to right.
+     */
+    void decompose(Space& s, unsigned int m, unsigned int d);
+    /// Add subproblem \a a (as returned by operator[]())
+    void add(const Archive& a);
+    /// Return number of subproblems
+    int size(void) const;
+    /// Return subproblem \a i
+    const Archive& operator [](int i) const;
+    /**
+     * \brief Commit subproblem \a i to \a s
+     *
+     * The space \a s must be a clone of the root space. Returns
+     * the number of choices committed.
+     */
+    unsigned int commit(Space& s, int i) const;
+    /// Archive all subproblems into \a e
+    void archive(Archive& e) const;
+  };
+
+}}
+
+#include <gecode/search/subproblems.hpp>
+
 namespace Gecode { namespace Search {
 
     class Stop;
@@ -441,6 +507,14 @@ namespace Gecode { namespace Search {
      * \f$n \times m\f$ threads are chosen. If \f$-1 <n<0\f$,
      * \f$(1+n)\times m\f$ threads are chosen.
      *
+     * If \a eps is not zero, parallel engines decompose the root space
+     * into at least \a eps subproblems per thread (expanding the search
+     * tree up to depth \a eps_depth) and dispatch them to idle workers
+     * before they try to steal work (embarrassingly parallel search). If
+     * \a subproblems is not NULL, the engine uses these subproblems for
+     * the root space instead (also with a single thread). Restarts
+     * always decompose the new root space if \a eps is not zero.
+     *
      * \ingroup TaskModelSearch
      */
     class Options {
@@ -465,10 +539,28 @@ namespace Gecode { namespace Search {
       unsigned int slice;
       /// Depth limit for extraction of no-goods
       unsigned int nogoods_limit;
+      /// Maximal number of no-good propagators kept by restarts (0 for no limit)
+      unsigned int nogoods_max;
+      /// Number of subproblems per thread for parallel search (0 for work stealing only)
+      unsigned int eps;
+      /// Depth limit for decomposition into subproblems
+      unsigned int eps_depth;
+      /// Subproblems for parallel search (NULL if decomposed by the engine)
+      const Subproblems* subproblems;
+      /// Number of worker processes created by distributed search
+      unsigned int processes;
+      /// Address for distributed search (TCP port or path of Unix-domain socket)
+      const char* address;
+      /// Command line (NULL-terminated) for starting worker processes of distributed search (NULL for forking)
+      const char* const* command;
       /// Stop object for stopping search
       Stop* stop;
       /// Cutoff for restart-based search
       Cutoff* cutoff;
+      /// Memory management policy for spaces of the engine (NULL if unchanged)
+      const MemoryPolicy* memory;
+      /// Propagator scheduling policy for spaces of the engine (NULL if unchanged)
+      const SchedulingPolicy* scheduling;
       /// Default options
       GECODE_SEARCH_EXPORT static const Options def;
       /// Initialize with default values
@@ -987,6 +1079,108 @@ namespace Gecode {
 
 #include <gecode/search/pbs.hpp>
 
+namespace Gecode { namespace Search { namespace Meta {
+
+  /**
+   * \brief Engines supported by distributed search
+   *
+   * Only DFS and BAB are supported.
+   */
+  template<class T, template<class> class E>
+  class DisEngine {
+  public:
+    /// Whether engine is supported
+    static const bool supported = false;
+    /// Whether engine does best solution search
+    static const bool best = false;
+  };
+  /// Distributed depth-first search
+  template<class T>
+  class DisEngine<T,DFS> {
+  public:
+    /// Whether engine is supported
+    static const bool supported = true;
+    /// Whether engine does best solution search
+    static const bool best = false;
+  };
+  /// Distributed branch-and-bound search
+  template<class T>
+  class DisEngine<T,BAB> {
+  public:
+    /// Whether engine is supported
+    static const bool supported = true;
+    /// Whether engine does best solution search
+    static const bool best = true;
+  };
+
+}}}
+
+namespace Gecode {
+
+  /**
+   * \brief Meta-engine performing distributed search
+   *
+   * The engine (the coordinator) decomposes the space into subproblems
+   * (see Search::Subproblems) and dispatches them to worker processes
+   * connected by a socket. The coordinator starts as many worker
+   * processes as defined by the options \a o (at least one if no
+   * address is given). If the options define an address (either a TCP
+   * port on the loopback interface or the path of a Unix-domain
+   * socket), more workers for the same model can be run in other
+   * processes by DIS::work.
+   *
+   * If the options define a command, the worker processes are started
+   * by executing the command (for example, the very program running
+   * the coordinator). The program must then check with DIS::worker
+   * whether it runs as a worker and call DIS::work. Otherwise the
+   * worker processes are forked from the current process and explore
+   * the search space in the state it has when forking. Forking is only
+   * safe before any other thread (including the threads of parallel
+   * search engines) has been started: if other threads are running,
+   * the exception Search::ThreadsRunning is thrown where this can be
+   * detected (on Linux).
+   *
+   * Workers explore subproblems by depth-first search (if \a E is DFS)
+   * or branch-and-bound search (if \a E is BAB) with recomputation as
+   * defined by the options \a o. For other engines, the exception
+   * Search::UnsupportedEngine is thrown. The
+   * workers return solutions as the alternatives and archived choices
+   * leading to them, which are recomputed by the coordinator. For
+   * branch-and-bound search, each better solution is sent to all
+   * workers as a bound. If a worker process terminates, its subproblem
+   * is dispatched again.
+   *
+   * If distributed search is not available, the engine runs \a E in
+   * the current process.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T, template<class> class E = DFS>
+  class DIS : public Search::Base<T> {
+  public:
+    /// Initialize engine for space \a s and options \a o
+    DIS(T* s, const Search::Options& o=Search::Options::def);
+    /**
+     * \brief Run worker for space \a s
+     *
+     * The worker connects to the coordinator at the address given by
+     * the options \a o (if the options define no address, the address
+     * passed by the coordinator that has started the process is used)
+     * and explores subproblems until the coordinator terminates. The
+     * space \a s must be created from the same model as the space of
+     * the coordinator.
+     */
+    static Search::Statistics work(T* s, const Search::Options& o);
+    /// Whether the process has been started as worker by a coordinator
+    static bool worker(void);
+    /// Whether engine does best solution search
+    static const bool best = Search::Meta::DisEngine<T,E>::best;
+  };
+
+}
+
+#include <gecode/search/dis.hpp>
+
 #endif
 
 // STATISTICS: search-other
@@ -48,7 +48,7 @@ namespace Gecode { namespace Search {
   dfs(Space* s, const Options& o) {
 #ifdef GECODE_HAS_THREADS
     Options to = o.expand();
-    if (to.threads == 1.0)
+    if ((to.threads == 1.0) && (to.subproblems == NULL))
       return new WorkerToEngine<Sequential::DFS>(s,to);
     else
       return new Parallel::DFS(s,to);
@@ -0,0 +1,103 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Search { namespace Meta {
+
+#ifdef GECODE_HAS_DISTRIBUTED
+
+  /// Create coordinator engine for distributed search
+  GECODE_SEARCH_EXPORT Engine*
+  dis(Space* s, const Options& o, bool best);
+
+  /// Run worker for distributed search
+  GECODE_SEARCH_EXPORT Statistics
+  work(Space* s, const Options& o, bool best);
+
+  /// Return address passed by coordinator to worker process (or NULL)
+  GECODE_SEARCH_EXPORT const char*
+  address(void);
+
+#endif
+
+  /// Create engine for distributed search with engine \a E
+  template<class T, template<class> class E>
+  inline Engine*
+  dis(T* s, const Options& o) {
+    if (!DisEngine<T,E>::supported)
+      throw UnsupportedEngine("DIS::DIS");
+#ifdef GECODE_HAS_DISTRIBUTED
+    return dis(s,o,DisEngine<T,E>::best);
+#else
+    return build<T,E>(s,o);
+#endif
+  }
+
+}}}
+
+namespace Gecode {
+
+  template<class T, template<class> class E>
+  inline
+  DIS<T,E>::DIS(T* s, const Search::Options& o)
+    : Search::Base<T>(Search::Meta::dis<T,E>(s,o)) {}
+
+  template<class T, template<class> class E>
+  inline Search::Statistics
+  DIS<T,E>::work(T* s, const Search::Options& o) {
+    if (!Search::Meta::DisEngine<T,E>::supported)
+      throw Search::UnsupportedEngine("DIS::work");
+#ifdef GECODE_HAS_DISTRIBUTED
+    return Search::Meta::work(s,o,best);
+#else
+    (void) s; (void) o;
+    return Search::Statistics();
+#endif
+  }
+
+  template<class T, template<class> class E>
+  inline bool
+  DIS<T,E>::worker(void) {
+#ifdef GECODE_HAS_DISTRIBUTED
+    return Search::Meta::address() != NULL;
+#else
+    return false;
+#endif
+  }
+
+}
+
+// STATISTICS: search-meta
@@ -52,6 +52,15 @@ namespace Gecode { namespace Search {
   NoBest::NoBest(const char* l)
     : Exception(l,"Best solution search is not supported") {}
 
+  CommunicationFailed::CommunicationFailed(const char* l)
+    : Exception(l,"Communication with another process failed") {}
+
+  UnsupportedEngine::UnsupportedEngine(const char* l)
+    : Exception(l,"Search engine is not supported") {}
+
+  ThreadsRunning::ThreadsRunning(const char* l)
+    : Exception(l,"Process cannot be forked while threads are running") {}
+
 }}
 
 // STATISTICS: search-other
@@ -66,6 +66,24 @@ namespace Gecode { namespace Search {
     /// Initialize with location \a l
     NoBest(const char* l);
   };
+  /// %Exception: Communication with another process failed
+  class GECODE_SEARCH_EXPORT CommunicationFailed : public Exception {
+  public:
+    /// Initialize with location \a l
+    CommunicationFailed(const char* l);
+  };
+  /// %Exception: Search engine is not supported
+  class GECODE_SEARCH_EXPORT UnsupportedEngine : public Exception {
+  public:
+    /// Initialize with location \a l
+    UnsupportedEngine(const char* l);
+  };
+  /// %Exception: Process cannot be forked as other threads are running
+  class GECODE_SEARCH_EXPORT ThreadsRunning : public Exception {
+  public:
+    /// Initialize with location \a l
+    ThreadsRunning(const char* l);
+  };
   //@}
 }}
 
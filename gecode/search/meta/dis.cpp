@@ -0,0 +1,889 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search/meta/dis.hh>
+#include <gecode/search/meta/dead.hh>
+#include <gecode/search/support.hh>
+#include <gecode/search/sequential/path.hh>
+
+#ifdef GECODE_HAS_DISTRIBUTED
+
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <dirent.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <unistd.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+#ifdef __APPLE__
+#include <crt_externs.h>
+#define environ (*_NSGetEnviron())
+#else
+extern char** environ;
+#endif
+
+namespace Gecode { namespace Search { namespace Meta {
+
+  /*
+   * Channels
+   *
+   */
+
+  /// Whether address \a a is a TCP port (all digits)
+  static bool
+  port(const char* a) {
+    if (*a == 0)
+      return false;
+    for ( ; *a != 0; a++)
+      if ((*a < '0') || (*a > '9'))
+        return false;
+    return true;
+  }
+
+  /// Create socket for address \a a and fill in socket address \a sa
+  static int
+  socket(const char* a, struct sockaddr_storage& sa, socklen_t& sl) {
+    memset(&sa, 0, sizeof(sa));
+    int fd;
+    if (port(a)) {
+      struct sockaddr_in* si = reinterpret_cast<struct sockaddr_in*>(&sa);
+      si->sin_family = AF_INET;
+      si->sin_port = htons(static_cast<unsigned short>(atoi(a)));
+      si->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      sl = sizeof(struct sockaddr_in);
+      fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    } else {
+      struct sockaddr_un* su = reinterpret_cast<struct sockaddr_un*>(&sa);
+      if (strlen(a) >= sizeof(su->sun_path))
+        throw CommunicationFailed("Search::Meta::Channel::socket");
+      su->sun_family = AF_UNIX;
+      strcpy(su->sun_path, a);
+      sl = sizeof(struct sockaddr_un);
+      fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    }
+    if (fd < 0)
+      throw CommunicationFailed("Search::Meta::Channel::socket");
+#ifdef SO_NOSIGPIPE
+    int one = 1;
+    (void) setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+    return fd;
+  }
+
+  forceinline
+  Channel::Channel(int fd0) : fd(fd0) {}
+
+  forceinline int
+  Channel::descriptor(void) const {
+    return fd;
+  }
+
+  void
+  Channel::pair(int fd[2]) {
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fd) < 0)
+      throw CommunicationFailed("Search::Meta::Channel::pair");
+#ifdef SO_NOSIGPIPE
+    for (int i=0; i<2; i++) {
+      int one = 1;
+      (void) setsockopt(fd[i], SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+    }
+#endif
+  }
+
+  int
+  Channel::listen(const char* a) {
+    struct sockaddr_storage sa; socklen_t sl;
+    int fd = socket(a,sa,sl);
+    if (port(a)) {
+      int one = 1;
+      (void) setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    } else {
+      (void) unlink(a);
+    }
+    if ((bind(fd, reinterpret_cast<struct sockaddr*>(&sa), sl) < 0) ||
+        (::listen(fd, SOMAXCONN) < 0)) {
+      (void) ::close(fd);
+      throw CommunicationFailed("Search::Meta::Channel::listen");
+    }
+    return fd;
+  }
+
+  int
+  Channel::connect(const char* a) {
+    // The coordinator might not be listening yet: retry for some time
+    for (int i=0; i<100; i++) {
+      struct sockaddr_storage sa; socklen_t sl;
+      int fd = socket(a,sa,sl);
+      if (::connect(fd, reinterpret_cast<struct sockaddr*>(&sa), sl) == 0)
+        return fd;
+      (void) ::close(fd);
+      Support::Thread::sleep(50);
+    }
+    throw CommunicationFailed("Search::Meta::Channel::connect");
+  }
+
+  int
+  Channel::accept(int l) {
+    int fd = ::accept(l, NULL, NULL);
+    if (fd < 0)
+      throw CommunicationFailed("Search::Meta::Channel::accept");
+#ifdef SO_NOSIGPIPE
+    int one = 1;
+    (void) setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+    return fd;
+  }
+
+  void
+  Channel::write(const void* b, size_t n) {
+    const char* c = static_cast<const char*>(b);
+    while (n > 0) {
+      ssize_t k = ::send(fd, c, n, MSG_NOSIGNAL);
+      if (k < 0) {
+        if (errno == EINTR)
+          continue;
+        throw CommunicationFailed("Search::Meta::Channel::send");
+      }
+      c += k; n -= static_cast<size_t>(k);
+    }
+  }
+
+  bool
+  Channel::read(void* b, size_t n) {
+    char* c = static_cast<char*>(b);
+    while (n > 0) {
+      ssize_t k = ::recv(fd, c, n, 0);
+      if (k == 0)
+        return false;
+      if (k < 0) {
+        if (errno == EINTR)
+          continue;
+        return false;
+      }
+      c += k; n -= static_cast<size_t>(k);
+    }
+    return true;
+  }
+
+  void
+  Channel::send(Message m, const Archive& e) {
+    // Message consists of its length, its kind, and the data
+    unsigned int n = static_cast<unsigned int>(e.size()) + 2U;
+    unsigned int* b = heap.alloc<unsigned int>(n);
+    b[0] = n-1U; b[1] = static_cast<unsigned int>(m);
+    for (int i=0; i<e.size(); i++)
+      b[i+2] = e[i];
+    try {
+      write(b, n*sizeof(unsigned int));
+    } catch (...) {
+      heap.free<unsigned int>(b,n);
+      throw;
+    }
+    heap.free<unsigned int>(b,n);
+  }
+
+  bool
+  Channel::receive(Message& m, Archive& e) {
+    unsigned int n;
+    if (!read(&n, sizeof(n)) || (n == 0U))
+      return false;
+    unsigned int* b = heap.alloc<unsigned int>(n);
+    if (!read(b, n*sizeof(unsigned int))) {
+      heap.free<unsigned int>(b,n);
+      return false;
+    }
+    m = static_cast<Message>(b[0]);
+    for (unsigned int i=1U; i<n; i++)
+      e << b[i];
+    heap.free<unsigned int>(b,n);
+    return true;
+  }
+
+  bool
+  Channel::available(void) const {
+    struct pollfd p;
+    p.fd = fd; p.events = POLLIN; p.revents = 0;
+    return poll(&p, 1, 0) > 0;
+  }
+
+  void
+  Channel::close(void) {
+    if (fd >= 0)
+      (void) ::close(fd);
+    fd = -1;
+  }
+
+
+  /*
+   * Statistics are sent as pairs of unsigned integers
+   *
+   */
+
+  /// Archive \a n to \a e
+  static void
+  put(Archive& e, unsigned long int n) {
+    e << static_cast<unsigned int>(n & 0xffffffffUL)
+      << static_cast<unsigned int>((n >> 16) >> 16);
+  }
+
+  /// Return value unarchived from \a e
+  static unsigned long int
+  get(Archive& e) {
+    unsigned int l, h; e >> l >> h;
+    return static_cast<unsigned long int>(l) |
+      ((static_cast<unsigned long int>(h) << 16) << 16);
+  }
+
+
+  /**
+   * \brief Recompute solution from path \a e for root \a r
+   *
+   * The solution is constrained by the best solution \a b (if not
+   * NULL). As a best solution is recomputed from its path and the
+   * previous best solution, the coordinator and all workers recompute
+   * the very same sequence of best solutions. Returns NULL if the
+   * solution is not better than \a b.
+   */
+  static Space*
+  recompute(Space* r, Archive& e, Space* b) {
+    Subproblems p; p.add(e);
+    Space* s = r->clone(false);
+    (void) p.commit(*s,0);
+    if (b != NULL)
+      s->constrain(*b);
+    if (s->status() == SS_FAILED) {
+      delete s;
+      return NULL;
+    }
+    // Deletes all pending branchers
+    (void) s->choice();
+    return s;
+  }
+
+  /// Serve coordinator connected by \a c for space \a s with options \a o
+  static Statistics
+  serve(Channel& c, Space* s, const Options& o, bool best);
+
+
+  /*
+   * The coordinator
+   *
+   */
+
+  DIS::DIS(Space* s, const Options& o, bool best0)
+    : opt(o.expand()), best(best0), root(s), b(NULL), bp(heap), n_bp(0),
+      sp_next(0), sp_lost(heap), l(-1), path(NULL), w(heap), w_sp(heap), n_w(0), pid(heap), n_pid(0),
+      solutions(heap), has_stopped(false), done(false) {
+    if (opt.subproblems != NULL) {
+      for (int i=0; i<opt.subproblems->size(); i++)
+        sp.add((*opt.subproblems)[i]);
+    } else {
+      unsigned int e = (opt.eps > 0U) ? opt.eps : Config::eps;
+      sp.decompose(*root, e * std::max(opt.processes,1U), opt.eps_depth);
+    }
+    if (opt.address != NULL) {
+      // Workers in other processes connect by the address
+      if (!port(opt.address)) {
+        path = heap.alloc<char>(static_cast<int>(strlen(opt.address))+1);
+        strcpy(path, opt.address);
+      }
+      l = Channel::listen(opt.address);
+    } else if (opt.command != NULL) {
+      // Executed workers connect by a Unix-domain socket of their own
+      static unsigned int n = 0;
+      const char* t = getenv("TMPDIR");
+      if ((t == NULL) || (strlen(t) > 64))
+        t = "/tmp";
+      char a[128];
+      sprintf(a, "%s/gecode-dis-%ld-%u", t,
+              static_cast<long int>(getpid()), n++);
+      path = heap.alloc<char>(static_cast<int>(strlen(a))+1);
+      strcpy(path, a);
+      l = Channel::listen(path);
+    }
+    // Without an address, at least one worker must be started
+    unsigned int n_p = std::max(opt.processes,
+                                (opt.address == NULL) ? 1U : 0U);
+    if (opt.command != NULL)
+      exec(n_p);
+    else
+      fork(n_p);
+  }
+
+  /// Whether other threads than the calling thread are running (if known)
+  static bool
+  threads(void) {
+    DIR* d = opendir("/proc/self/task");
+    if (d == NULL)
+      return false;
+    int n = 0;
+    while (struct dirent* e = readdir(d))
+      if (e->d_name[0] != '.')
+        n++;
+    (void) closedir(d);
+    return n > 1;
+  }
+
+  void
+  DIS::fork(unsigned int n) {
+    /*
+     * The forked worker inherits all locks held by other threads in
+     * their current state, it might deadlock when allocating memory.
+     */
+    if ((n > 0U) && threads()) {
+      terminate();
+      throw ThreadsRunning("Search::Meta::DIS::DIS");
+    }
+    // Forked workers are connected right away
+    for (unsigned int i=0U; i<n; i++) {
+      int fd[2];
+      try {
+        Channel::pair(fd);
+      } catch (CommunicationFailed&) {
+        terminate();
+        throw;
+      }
+      int p = ::fork();
+      if (p < 0) {
+        (void) ::close(fd[0]); (void) ::close(fd[1]);
+        terminate();
+        throw CommunicationFailed("Search::Meta::DIS::DIS");
+      }
+      if (p == 0) {
+        // The worker process only keeps its own connection
+        (void) ::close(fd[0]);
+        if (l >= 0)
+          (void) ::close(l);
+        for (int j=0; j<n_w; j++)
+          w[j].close();
+        Channel c(fd[1]);
+        try {
+          (void) serve(c, root, opt, best);
+        } catch (...) {
+          _exit(EXIT_FAILURE);
+        }
+        _exit(EXIT_SUCCESS);
+      }
+      (void) ::close(fd[1]);
+      pid[n_pid++] = p;
+      w[n_w] = Channel(fd[0]); w_sp[n_w] = -1; n_w++;
+    }
+  }
+
+  void
+  DIS::exec(unsigned int n) {
+    if (n == 0U)
+      return;
+    // The environment of the workers passes the address
+    const char* a = (path != NULL) ? path : opt.address;
+    const char* v = "GECODE_DIS_ADDRESS=";
+    int n_e = 0;
+    while (environ[n_e] != NULL)
+      n_e++;
+    char** e = heap.alloc<char*>(n_e+2);
+    int k = 0;
+    e[k++] = heap.alloc<char>(static_cast<int>(strlen(v)+strlen(a))+1);
+    strcpy(e[0], v); strcat(e[0], a);
+    for (int i=0; i<n_e; i++)
+      if (strncmp(environ[i], v, strlen(v)) != 0)
+        e[k++] = environ[i];
+    e[k] = NULL;
+    // Only async-signal-safe functions are used after forking
+    for (unsigned int i=0U; i<n; i++) {
+      int p = ::fork();
+      if (p == 0) {
+        (void) ::close(l);
+        environ = e;
+        (void) execvp(opt.command[0], const_cast<char* const*>(opt.command));
+        _exit(EXIT_FAILURE);
+      }
+      if (p > 0)
+        pid[n_pid++] = p;
+    }
+    heap.free<char>(e[0],static_cast<int>(strlen(e[0]))+1);
+    heap.free<char*>(e,n_e+2);
+    if (n_pid == 0) {
+      terminate();
+      throw CommunicationFailed("Search::Meta::DIS::DIS");
+    }
+  }
+
+  bool
+  DIS::alive(void) {
+    for (int i=n_pid; i--; ) {
+      int status;
+      if (waitpid(pid[i], &status, WNOHANG) == pid[i])
+        pid[i] = pid[--n_pid];
+    }
+    return n_pid > 0;
+  }
+
+  bool
+  DIS::finished(void) const {
+    if ((sp_next < sp.size()) || !sp_lost.empty())
+      return false;
+    for (int i=0; i<n_w; i++)
+      if (w_sp[i] >= 0)
+        return false;
+    return true;
+  }
+
+  void
+  DIS::dispatch(void) {
+    for (int i=n_w; i--; )
+      if ((w_sp[i] < 0) && ((sp_next < sp.size()) || !sp_lost.empty())) {
+        int j = sp_lost.empty() ? sp_next++ : sp_lost.pop();
+        w_sp[i] = j;
+        try {
+          w[i].send(M_WORK, sp[j]);
+        } catch (CommunicationFailed&) {
+          lost(i);
+        }
+      }
+  }
+
+  void
+  DIS::lost(int i) {
+    if (w_sp[i] >= 0)
+      sp_lost.push(w_sp[i]);
+    w[i].close();
+    n_w--;
+    w[i] = w[n_w]; w_sp[i] = w_sp[n_w];
+  }
+
+  void
+  DIS::solution(Archive& e) {
+    Space* s = recompute(root, e, best ? b : NULL);
+    // Not better than the best solution so far
+    if (s == NULL)
+      return;
+    if (best) {
+      delete b;
+      b = s->clone(false);
+      bp[n_bp++] = e;
+      // Lost workers are detected when receiving from them
+      for (int i=0; i<n_w; i++)
+        try {
+          w[i].send(M_BOUND, e);
+        } catch (CommunicationFailed&) {}
+    }
+    solutions.push(s);
+  }
+
+  void
+  DIS::handle(int i, Message m, Archive& e) {
+    switch (m) {
+    case M_SOLUTION:
+      solution(e);
+      break;
+    case M_DONE:
+      {
+        stat.node += get(e); stat.fail += get(e);
+        stat.propagate += get(e);
+        stat.depth = std::max(stat.depth,get(e));
+        w_sp[i] = -1;
+      }
+      break;
+    default:
+      lost(i);
+    }
+  }
+
+  void
+  DIS::wait(int t) {
+    int n = n_w;
+    struct pollfd* p = heap.alloc<struct pollfd>(n+1);
+    // A negative descriptor is ignored by poll
+    p[0].fd = l; p[0].events = POLLIN; p[0].revents = 0;
+    for (int i=0; i<n; i++) {
+      p[i+1].fd = w[i].descriptor(); p[i+1].events = POLLIN;
+      p[i+1].revents = 0;
+    }
+    if (poll(p, static_cast<nfds_t>(n+1), t) <= 0) {
+      heap.free<struct pollfd>(p,n+1);
+      return;
+    }
+    // Handle workers in reverse order as lost workers are removed
+    for (int i=n; i--; )
+      if (p[i+1].revents != 0) {
+        Message m; Archive e;
+        bool ok;
+        try {
+          ok = w[i].receive(m,e);
+        } catch (CommunicationFailed&) {
+          ok = false;
+        }
+        if (ok)
+          handle(i,m,e);
+        else
+          lost(i);
+      }
+    if (p[0].revents & POLLIN) {
+      Channel c;
+      try {
+        c = Channel(Channel::accept(l));
+        // The worker needs all best solutions to recompute them
+        for (int i=0; i<n_bp; i++)
+          c.send(M_BOUND, bp[i]);
+        w[n_w] = c; w_sp[n_w] = -1; n_w++;
+      } catch (CommunicationFailed&) {
+        c.close();
+      }
+    }
+    heap.free<struct pollfd>(p,n+1);
+  }
+
+  void
+  DIS::terminate(void) {
+    Archive e;
+    for (int i=0; i<n_w; i++) {
+      try {
+        w[i].send(M_TERMINATE, e);
+      } catch (CommunicationFailed&) {}
+      w[i].close();
+    }
+    n_w = 0;
+    if (l >= 0) {
+      (void) ::close(l);
+      l = -1;
+    }
+    if (path != NULL)
+      (void) unlink(path);
+    /*
+     * Workers terminate as their connection is closed. Executed workers
+     * that have not connected yet would wait for the coordinator in vain.
+     */
+    for (int i=0; i<n_pid; i++) {
+      if (opt.command != NULL)
+        (void) kill(pid[i], SIGTERM);
+      int status;
+      while ((waitpid(pid[i], &status, 0) < 0) && (errno == EINTR)) {}
+    }
+    n_pid = 0;
+  }
+
+  Space*
+  DIS::next(void) {
+    has_stopped = false;
+    while (true) {
+      if (!solutions.empty())
+        return solutions.pop();
+      if (done)
+        return NULL;
+      dispatch();
+      if (finished()) {
+        terminate();
+        done = true;
+        continue;
+      }
+      /*
+       * All workers are lost and no other worker can connect: either
+       * there is no address or all workers connecting by the address
+       * of the coordinator have terminated.
+       */
+      if ((n_w == 0) &&
+          ((l < 0) || ((opt.address == NULL) && !alive())))
+        throw CommunicationFailed("Search::Meta::DIS::next");
+      if (opt.stop != NULL) {
+        if (opt.stop->stop(stat,opt)) {
+          has_stopped = true;
+          return NULL;
+        }
+        // Check the stop object regularly
+        wait(50);
+      } else {
+        // Check regularly whether started workers have terminated
+        wait((n_w == 0) ? 50 : -1);
+      }
+    }
+    GECODE_NEVER;
+    return NULL;
+  }
+
+  Statistics
+  DIS::statistics(void) const {
+    return stat;
+  }
+
+  bool
+  DIS::stopped(void) const {
+    return has_stopped;
+  }
+
+  DIS::~DIS(void) {
+    terminate();
+    while (!solutions.empty())
+      delete solutions.pop();
+    if (path != NULL)
+      heap.free<char>(path,static_cast<int>(strlen(path))+1);
+    delete b;
+    delete root;
+  }
+
+
+  /*
+   * The worker
+   *
+   */
+
+  /// Path of a worker that can be archived
+  class Path : public Search::Sequential::Path {
+  public:
+    /**
+     * \brief Initialize
+     *
+     * As no no-goods are extracted, the depth limit for no-goods makes
+     * sure that all edges are kept on the path so that it can be archived.
+     */
+    Path(void) : Search::Sequential::Path(UINT_MAX) {}
+    /// Archive alternatives and choices of path to \a e
+    void archive(Archive& e) const {
+      for (int i=0; i<ds.entries(); i++) {
+        e << ds[i].alt();
+        ds[i].choice()->archive(e);
+      }
+    }
+  };
+
+  /// Bounds known to a worker
+  class Bounds {
+  public:
+    /// Best solution of the coordinator
+    Space* cb;
+    /// Best solution to constrain with (from coordinator or worker)
+    Space* b;
+    /// Number of bounds
+    unsigned int n;
+    /// Initialize without bounds
+    Bounds(void) : cb(NULL), b(NULL), n(0U) {}
+    /// Update by path \a e of best solution of coordinator for root \a r
+    void coordinator(Space* r, Archive& e) {
+      Space* s = recompute(r,e,cb);
+      // Cannot fail as the coordinator has recomputed it just the same
+      assert(s != NULL);
+      delete cb; cb = s;
+      delete b; b = cb->clone(false);
+      n++;
+    }
+    /// Update by solution \a s of worker
+    void worker(Space* s) {
+      delete b; b = s;
+      n++;
+    }
+    /// Delete bounds
+    ~Bounds(void) {
+      delete cb; delete b;
+    }
+  };
+
+  /**
+   * \brief Explore subproblem \a e from root \a r with options \a o
+   *
+   * Performs depth-first search (branch-and-bound search if \a best
+   * is true) with recomputation as the sequential engines do. Returns
+   * whether the worker must terminate. Bounds received while exploring
+   * update the bounds \a bs.
+   */
+  static bool
+  explore(Channel& c, Space* r, const Archive& e, const Options& o,
+          bool best, Bounds& bs, Worker& stat) {
+    Subproblems p; p.add(e);
+    Space* cur = r->clone(false);
+    unsigned int k = p.commit(*cur,0);
+    stat.reset(k);
+    Path path;
+    // Distance until next clone
+    unsigned int d = 0;
+    // Number of entries not yet constrained by the best bound
+    int mark = 0;
+    if (best && (bs.b != NULL))
+      cur->constrain(*bs.b);
+    bool t = false;
+    while (true) {
+      if (c.available()) {
+        Message m; Archive be;
+        if (!c.receive(m,be) || (m == M_TERMINATE)) {
+          t = true; break;
+        }
+        if (m == M_BOUND) {
+          bs.coordinator(r,be);
+          if (best) {
+            if (cur != NULL)
+              cur->constrain(*bs.b);
+            mark = path.entries();
+          }
+        }
+      }
+      while (cur == NULL) {
+        if (path.empty())
+          goto done;
+        cur = (best && (bs.b != NULL)) ?
+          path.recompute(d,o.a_d,stat,*bs.b,mark) :
+          path.recompute(d,o.a_d,stat);
+        if (cur != NULL)
+          break;
+        path.next();
+      }
+      stat.node++;
+      switch (cur->status(stat)) {
+      case SS_FAILED:
+        stat.fail++;
+        delete cur; cur = NULL;
+        path.next();
+        break;
+      case SS_SOLVED:
+        {
+          // Send the alternatives and choices leading to the solution
+          Archive s;
+          s << (k + static_cast<unsigned int>(path.entries()));
+          for (int i=1; i<e.size(); i++)
+            s << e[i];
+          path.archive(s);
+          c.send(M_SOLUTION, s);
+          // Deletes all pending branchers
+          (void) cur->choice();
+          if (best)
+            bs.worker(cur);
+          else
+            delete cur;
+          cur = NULL;
+          path.next();
+          mark = path.entries();
+        }
+        break;
+      case SS_BRANCH:
+        {
+          Space* cl;
+          if ((d == 0) || (d >= o.c_d)) {
+            cl = cur->clone();
+            d = 1;
+          } else {
+            cl = NULL;
+            d++;
+          }
+          const Choice* ch = path.push(stat,cur,cl);
+          cur->commit(*ch,0);
+        }
+        break;
+      default: GECODE_NEVER;
+      }
+    }
+  done:
+    delete cur;
+    path.reset();
+    return t;
+  }
+
+  static Statistics
+  serve(Channel& c, Space* s, const Options& o, bool best) {
+    Statistics stat;
+    bool failed = (s->status(stat) == SS_FAILED);
+    Space* r = (o.clone && !failed) ? s->clone(false) : s;
+    Bounds bs;
+    try {
+      Message m; Archive e;
+      while (c.receive(m,e)) {
+        if (m == M_TERMINATE)
+          break;
+        if (m == M_BOUND) {
+          if (!failed)
+            bs.coordinator(r,e);
+        } else if (m == M_WORK) {
+          Worker ws;
+          bool t = !failed && explore(c,r,e,o,best,bs,ws);
+          stat += ws;
+          if (t)
+            break;
+          Archive d;
+          put(d,ws.node); put(d,ws.fail); put(d,ws.propagate);
+          put(d,ws.depth);
+          c.send(M_DONE, d);
+        }
+        e = Archive();
+      }
+    } catch (CommunicationFailed&) {
+      // The coordinator has terminated
+    }
+    c.close();
+    if (r != s)
+      delete r;
+    return stat;
+  }
+
+  const char*
+  address(void) {
+    return getenv("GECODE_DIS_ADDRESS");
+  }
+
+  Statistics
+  work(Space* s, const Options& o, bool best) {
+    const char* a = (o.address != NULL) ? o.address : address();
+    if (a == NULL)
+      throw CommunicationFailed("Search::Meta::work");
+    Channel c(Channel::connect(a));
+    return serve(c, s, o.expand(), best);
+  }
+
+  Engine*
+  dis(Space* s, const Options& o, bool best) {
+    Statistics stat;
+    if (s->status(stat) == SS_FAILED) {
+      stat.fail++;
+      return new Dead(stat);
+    }
+    return new DIS(snapshot(s,o,false),o,best);
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-meta
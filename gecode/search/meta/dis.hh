@@ -0,0 +1,170 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_META_DIS_HH__
+#define __GECODE_SEARCH_META_DIS_HH__
+
+#include <gecode/search.hh>
+
+#ifdef GECODE_HAS_DISTRIBUTED
+
+namespace Gecode { namespace Search { namespace Meta {
+
+  /// Messages exchanged between coordinator and workers
+  enum Message {
+    M_WORK,      ///< Explore subproblem (to worker)
+    M_BOUND,     ///< Path to better solution (to worker)
+    M_TERMINATE, ///< Terminate (to worker)
+    M_SOLUTION,  ///< Path to solution (to coordinator)
+    M_DONE       ///< Subproblem explored, with statistics (to coordinator)
+  };
+
+  /// Connection to another process by a socket
+  class Channel {
+  protected:
+    /// The socket descriptor
+    int fd;
+    /// Write \a n bytes from \a b
+    void write(const void* b, size_t n);
+    /// Read \a n bytes into \a b, return false if connection is closed
+    bool read(void* b, size_t n);
+  public:
+    /// Initialize for socket descriptor \a fd
+    Channel(int fd=-1);
+    /// Create pair of connected sockets \a fd
+    static void pair(int fd[2]);
+    /// Create socket listening at address \a a
+    static int listen(const char* a);
+    /// Create socket connected to address \a a
+    static int connect(const char* a);
+    /// Accept connection on listening socket \a l
+    static int accept(int l);
+    /// Return socket descriptor
+    int descriptor(void) const;
+    /// Send message \a m with data \a e
+    void send(Message m, const Archive& e);
+    /// Receive message \a m with data \a e, return false if connection is closed
+    bool receive(Message& m, Archive& e);
+    /// Whether a message can be received without blocking
+    bool available(void) const;
+    /// Close connection
+    void close(void);
+  };
+
+  /// Coordinator for distributed search
+  class GECODE_SEARCH_EXPORT DIS : public Engine {
+  protected:
+    /// Search options
+    Options opt;
+    /// Whether best solution search is performed
+    bool best;
+    /// The root space (propagated)
+    Space* root;
+    /// The best solution so far (best solution search only)
+    Space* b;
+    /// Paths to all best solutions so far
+    Support::DynamicArray<Archive,Heap> bp;
+    /// Number of best solutions so far
+    int n_bp;
+    /// The subproblems
+    Subproblems sp;
+    /// Next subproblem to dispatch
+    int sp_next;
+    /// Subproblems to be dispatched again (from lost workers)
+    Support::DynamicStack<int,Heap> sp_lost;
+    /// Listening socket (-1 if no address is given)
+    int l;
+    /// Path of Unix-domain socket (NULL for TCP or no address)
+    char* path;
+    /// Connections to workers
+    Support::DynamicArray<Channel,Heap> w;
+    /// Subproblem of each worker (-1 if idle)
+    Support::DynamicArray<int,Heap> w_sp;
+    /// Number of workers
+    int n_w;
+    /// Process identifiers of started workers
+    Support::DynamicArray<int,Heap> pid;
+    /// Number of started workers
+    int n_pid;
+    /// Solutions not yet returned
+    Support::DynamicQueue<Space*,Heap> solutions;
+    /// Search statistics
+    Statistics stat;
+    /// Whether the engine has been stopped
+    bool has_stopped;
+    /// Whether all subproblems have been explored
+    bool done;
+    /// Whether all workers are idle and no subproblem is left
+    bool finished(void) const;
+    /// Dispatch subproblems to idle workers
+    void dispatch(void);
+    /// Wait for and handle messages (at most \a t milliseconds, -1 for no limit)
+    void wait(int t);
+    /// Handle message \a m with data \a e from worker \a i
+    void handle(int i, Message m, Archive& e);
+    /// Handle path \a e to solution
+    void solution(Archive& e);
+    /// Remove worker \a i after it has been lost
+    void lost(int i);
+    /// Fork worker processes
+    void fork(unsigned int n);
+    /// Start worker processes by executing the command of the options
+    void exec(unsigned int n);
+    /// Whether some started worker process has not yet terminated
+    bool alive(void);
+    /// Terminate all workers
+    void terminate(void);
+  public:
+    /// Initialize for space \a s (propagated) with options \a o
+    DIS(Space* s, const Options& o, bool best);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Delete object
+    virtual ~DIS(void);
+  };
+
+}}}
+
+#endif
+
+#endif
+
+// STATISTICS: search-meta
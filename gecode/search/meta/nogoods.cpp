@@ -77,6 +77,62 @@ namespace Gecode { namespace Search { namespace Meta {
     return NULL;
   }
 
+
+  NegNGL::NegNGL(Space& home, NGL* l0)
+    : NGL(home), l(l0) {}
+  NegNGL::NegNGL(Space& home, bool share, NegNGL& ngl)
+    : NGL(home,share,ngl), l(ngl.l->copy(home,share)) {}
+  void
+  NegNGL::subscribe(Space& home, Propagator& p) {
+    l->subscribe(home,p);
+  }
+  void
+  NegNGL::cancel(Space& home, Propagator& p) {
+    l->cancel(home,p);
+  }
+  void
+  NegNGL::reschedule(Space& home, Propagator& p) {
+    l->reschedule(home,p);
+  }
+  NGL::Status
+  NegNGL::status(const Space& home) const {
+    switch (l->status(home)) {
+    case NGL::FAILED:   return NGL::SUBSUMED;
+    case NGL::SUBSUMED: return NGL::FAILED;
+    case NGL::NONE:     return NGL::NONE;
+    default: GECODE_NEVER;
+    }
+    return NGL::NONE;
+  }
+  ExecStatus
+  NegNGL::prune(Space&) {
+    return ES_OK;
+  }
+  NGL*
+  NegNGL::copy(Space& home, bool share) {
+    return new (home) NegNGL(home,share,*this);
+  }
+  bool
+  NegNGL::notice(void) const {
+    return l->notice();
+  }
+  size_t
+  NegNGL::dispose(Space& home) {
+    home.rfree(l,l->dispose(home));
+    return sizeof(*this);
+  }
+
+  SharedHandle::Object*
+  NoGoodsProp::Activity::ActivityObject::copy(void) const {
+    GECODE_NEVER;
+    return NULL;
+  }
+  bool
+  NoGoodsProp::Activity::ActivityObject::immutable(void) const {
+    return true;
+  }
+
+
   Actor*
   NoGoodsProp::copy(Space& home, bool share) {
     return new (home) NoGoodsProp(home,share,*this);
@@ -114,6 +170,9 @@ namespace Gecode { namespace Search { namespace Meta {
         // Prune leaf-literals
         while ((l != NULL) && l->leaf()) {
           l->cancel(home,*this); n--;
+          act.bump();
+          // Keep root valid in case dispose() runs after failure
+          root = l;
           GECODE_ES_CHECK(l->prune(home));
           l = disposenext(l,home,*this,false);
         }
@@ -147,11 +206,16 @@ namespace Gecode { namespace Search { namespace Meta {
       while ((l != NULL) && l->leaf()) {
         switch (l->status(home)) {
         case NGL::SUBSUMED:
-          l = disposenext(l,home,*this,true); n--;
-          p->next(l);
           GECODE_ES_CHECK(root->prune(home));
-          if (root->status(home) == NGL::FAILED)
+          if (root->status(home) == NGL::FAILED) {
+            act.bump();
             return home.ES_SUBSUMED(*this);
+          }
+          /*
+           * The root literal cannot be pruned (it is negated): keep the
+           * leaf, it fails as soon as the root literal holds.
+           */
+          p = l; l = l->next();
           break;
         case NGL::FAILED:
           l = disposenext(l,home,*this,true); n--;
@@ -217,10 +281,64 @@ namespace Gecode { namespace Search { namespace Meta {
         l = disposenext(l,home,*this,false);
     }
     home.ignore(*this,AP_DISPOSE,true);
+    if (act.propagator() == this)
+      act.propagator(NULL);
+    act.~Activity();
     (void) Propagator::dispose(home);
     return sizeof(*this);
   }
 
+
+  /// Order no-good propagators by increasing activity
+  class NoGoodsPropLess {
+  public:
+    bool operator ()(const std::pair<double,unsigned int>& x,
+                     const std::pair<double,unsigned int>& y) {
+      return x.first < y.first;
+    }
+  };
+
+  NoGoodsProps::NoGoodsProps(void)
+    : a(heap), n(0U) {}
+
+  void
+  NoGoodsProps::compact(void) {
+    unsigned int j = 0U;
+    for (unsigned int i=0U; i<n; i++)
+      if (a[i].propagator() != NULL)
+        a[j++] = a[i];
+    // Release the activities of propagators that no longer exist
+    for (unsigned int i=j; i<n; i++)
+      a[i] = NoGoodsProp::Activity();
+    n = j;
+  }
+
+  void
+  NoGoodsProps::add(Space& home, NoGoodsProp& p, unsigned int m) {
+    if (home.failed())
+      return;
+    compact();
+    for (unsigned int i=0U; i<n; i++)
+      a[i].decay(Config::nogoods_decay);
+    // Keep p and the m-1 most active other propagators
+    if (n >= m) {
+      Region r(home);
+      std::pair<double,unsigned int>* s =
+        r.alloc<std::pair<double,unsigned int> >(n);
+      for (unsigned int i=0U; i<n; i++)
+        s[i] = std::make_pair(a[i].activity(),i);
+      NoGoodsPropLess ngpl;
+      Support::quicksort<std::pair<double,unsigned int>,NoGoodsPropLess>
+        (s,static_cast<int>(n),ngpl);
+      // Deleting a propagator also resets its reference in the activity
+      for (unsigned int i=0U; i<n-(m-1U); i++)
+        a[s[i].second].propagator()->kill(home);
+      compact();
+    }
+    p.act.propagator(&p);
+    a[n++] = p.act;
+  }
+
 }}}
 
 // STATISTICS: search-meta
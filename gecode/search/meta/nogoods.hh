@@ -65,15 +65,104 @@ namespace Gecode { namespace Search { namespace Meta {
     virtual NGL* copy(Space& home, bool share);
   };
 
+  /**
+   * \brief Class for the negation of a no-good literal
+   *
+   * The negation is only used as a condition of a no-good. As the
+   * negated literal cannot be enforced, pruning does nothing. The
+   * no-good propagator then keeps leaves that hold and fails as soon
+   * as the negation holds.
+   */
+  class GECODE_VTABLE_EXPORT NegNGL : public NGL {
+  protected:
+    /// The negated no-good literal
+    NGL* l;
+  public:
+    /// Constructor for creation
+    NegNGL(Space& home, NGL* l);
+    /// Constructor for cloning \a ngl
+    NegNGL(Space& home, bool share, NegNGL& ngl);
+    /// Subscribe propagator \a p to all views of the no-good literal
+    virtual void subscribe(Space& home, Propagator& p);
+    /// Schedule propagator \a p for all views of the no-good literal
+    virtual void reschedule(Space& home, Propagator& p);
+    /// Cancel propagator \a p from all views of the no-good literal
+    virtual void cancel(Space& home, Propagator& p);
+    /// Test the status of the no-good literal
+    virtual NGL::Status status(const Space& home) const;
+    /// Propagate the negation of the no-good literal (does nothing)
+    virtual ExecStatus prune(Space& home);
+    /// Create copy
+    virtual NGL* copy(Space& home, bool share);
+    /// Whether dispose must always be called (as for the negated literal)
+    virtual bool notice(void) const;
+    /// Dispose
+    virtual size_t dispose(Space& home);
+  };
+
+  class NoGoodsProps;
+
   /// No-good propagator
   class GECODE_SEARCH_EXPORT NoGoodsProp : public Propagator {
+    friend class NoGoodsProps;
   protected:
+    /**
+     * \brief Activity of the no-goods of a propagator
+     *
+     * The activity is shared by all copies of a propagator (also
+     * among the workers of a parallel engine) and is updated
+     * atomically. It is incremented whenever the propagator prunes
+     * and decays whenever new no-goods are posted.
+     *
+     * The activity also refers to the copy of the propagator in the
+     * master space of a restart-based engine. The reference is only
+     * changed while the master space is posted to or cloned, when no
+     * other copies of the propagator are used.
+     */
+    class Activity : public SharedHandle {
+    protected:
+      /// The actual activity
+      class ActivityObject : public SharedHandle::Object {
+      public:
+        /// The activity
+        double a;
+        /// The propagator in the master space (NULL if there is none)
+        NoGoodsProp* p;
+        /// Initialize
+        ActivityObject(void);
+        /// Never copied (shared by all copies)
+        virtual SharedHandle::Object* copy(void) const;
+        /// Never copied (shared by all copies)
+        virtual bool immutable(void) const;
+      };
+    public:
+      /// Default constructor (no activity is recorded)
+      Activity(void);
+      /// Initialize activity if \a a is true
+      Activity(bool a);
+      /// Copy constructor
+      Activity(const Activity& a);
+      /// Whether activity is recorded
+      bool recorded(void) const;
+      /// Increment activity
+      void bump(void) const;
+      /// Decay activity by factor \a d
+      void decay(double d) const;
+      /// Return activity
+      double activity(void) const;
+      /// Return propagator in master space (NULL if there is none)
+      NoGoodsProp* propagator(void) const;
+      /// %Set propagator in master space to \a p
+      void propagator(NoGoodsProp* p) const;
+    };
     /// Root of no-good literal tree
     NGL* root;
     /// Number of no-good literals with subscriptions
     unsigned int n;
+    /// Activity (only recorded if the number of propagators is limited)
+    Activity act;
     /// Constructor for creation
-    NoGoodsProp(Space& home, NGL* root);
+    NoGoodsProp(Space& home, NGL* root, bool a);
     /// Constructor for cloning \a p
     NoGoodsProp(Space& home, bool shared, NoGoodsProp& p);
   public:
@@ -85,13 +174,49 @@ namespace Gecode { namespace Search { namespace Meta {
     virtual void reschedule(Space& home);
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
-    /// Post propagator for path \a p
+    /**
+     * \brief Post propagator for path \a p
+     *
+     * If the path does not start at the root of the search tree, the
+     * \a pn literals \a pl describe the alternatives leading from the
+     * root to the start of the path. If the number of no-good
+     * propagators is limited, the propagator is added to the no-good
+     * propagators of the path.
+     */
     template<class Path>
-    static ExecStatus post(Space& home, const Path& p);
+    static ExecStatus post(Space& home, const Path& p,
+                           NGL** pl=NULL, int pn=0);
     /// Delete propagator and return its size
     virtual size_t dispose(Space& home);
   };
 
+  /**
+   * \brief No-good propagators posted in the master space
+   *
+   * Keeps the activities of all no-good propagators posted in the
+   * master space of a restart-based engine, such that the least
+   * active ones can be deleted without inspecting all propagators.
+   */
+  class GECODE_SEARCH_EXPORT NoGoodsProps {
+  protected:
+    /// Activities of the propagators
+    Support::DynamicArray<NoGoodsProp::Activity,Heap> a;
+    /// Number of propagators
+    unsigned int n;
+    /// Remove propagators that no longer exist
+    void compact(void);
+  public:
+    /// Initialize
+    NoGoodsProps(void);
+    /**
+     * \brief Add propagator \a p and keep at most \a m propagators in \a home
+     *
+     * Decays the activity of all propagators except \a p and deletes
+     * the least active ones other than \a p.
+     */
+    void add(Space& home, NoGoodsProp& p, unsigned int m);
+  };
+
   forceinline
   NoNGL::NoNGL(void) {}
 
@@ -106,11 +231,58 @@ namespace Gecode { namespace Search { namespace Meta {
 
 
   forceinline
-  NoGoodsProp::NoGoodsProp(Space& home, NGL* root0)
-    : Propagator(Home(home)), root(root0), n(0U) {
+  NoGoodsProp::Activity::ActivityObject::ActivityObject(void)
+    : a(1.0), p(NULL) {}
+
+  forceinline
+  NoGoodsProp::Activity::Activity(void) {}
+  forceinline
+  NoGoodsProp::Activity::Activity(bool a)
+    : SharedHandle(a ? new ActivityObject : NULL) {}
+  forceinline
+  NoGoodsProp::Activity::Activity(const Activity& a)
+    : SharedHandle(a) {}
+  forceinline bool
+  NoGoodsProp::Activity::recorded(void) const {
+    return object() != NULL;
+  }
+  forceinline void
+  NoGoodsProp::Activity::bump(void) const {
+    if (object() != NULL)
+      (void) Support::atomic_add
+        (static_cast<ActivityObject*>(object())->a,1.0);
+  }
+  forceinline void
+  NoGoodsProp::Activity::decay(double d) const {
+    // Only called during a restart when no other copies are used
+    if (object() != NULL)
+      static_cast<ActivityObject*>(object())->a *= d;
+  }
+  forceinline double
+  NoGoodsProp::Activity::activity(void) const {
+    return (object() != NULL) ?
+      Support::atomic_relaxed_load
+        (static_cast<ActivityObject*>(object())->a) : 0.0;
+  }
+  forceinline NoGoodsProp*
+  NoGoodsProp::Activity::propagator(void) const {
+    return (object() != NULL) ?
+      static_cast<ActivityObject*>(object())->p : NULL;
+  }
+  forceinline void
+  NoGoodsProp::Activity::propagator(NoGoodsProp* p) const {
+    if (object() != NULL)
+      static_cast<ActivityObject*>(object())->p = p;
+  }
+
+
+  forceinline
+  NoGoodsProp::NoGoodsProp(Space& home, NGL* root0, bool a)
+    : Propagator(Home(home)), root(root0), n(0U), act(a) {
     // Create subscriptions
     root->subscribe(home,*this); n++;
-    bool notice = root->notice();
+    // The activity must be released when the space is deleted
+    bool notice = a || root->notice();
     NGL* l = root->next();
     while ((l != NULL) && l->leaf()) {
       l->subscribe(home,*this); n++;
@@ -131,6 +303,10 @@ namespace Gecode { namespace Search { namespace Meta {
   forceinline
   NoGoodsProp::NoGoodsProp(Space& home, bool shared, NoGoodsProp& p)
     : Propagator(home,shared,p), n(p.n) {
+    act.update(home,shared,p.act);
+    // Follow the propagator when the master space is cloned
+    if (act.propagator() == &p)
+      act.propagator(this);
     assert(p.root != NULL);
     NoNGL s;
     NGL* c = &s;
@@ -146,7 +322,7 @@ namespace Gecode { namespace Search { namespace Meta {
 
   template<class Path>
   forceinline ExecStatus
-  NoGoodsProp::post(Space& home, const Path& p) {
+  NoGoodsProp::post(Space& home, const Path& p, NGL** pl, int pn) {
     int s = 0;
     int n = std::min(p.ds.entries(),static_cast<int>(p.ngdl()));
 
@@ -161,8 +337,12 @@ namespace Gecode { namespace Search { namespace Meta {
     // Current no-good literal
     NGL* c = &nn;
 
-    // Commit no-goods at the beginning
-    while ((s < n) && (p.ds[s].truealt() > 0U))
+    // Literals leading to the start of the path
+    for (int i=0; i<pn; i++)
+      c = c->add(pl[i],false);
+
+    // Commit no-goods at the beginning (only if starting at the root)
+    while ((pn == 0) && (s < n) && (p.ds[s].truealt() > 0U))
       // Try whether this is a rightmost alternative
       if (p.ds[s].rightmost()) {
         // No literal needed, directly try to commit
@@ -226,7 +406,10 @@ namespace Gecode { namespace Search { namespace Meta {
 
     const_cast<Path&>(p).ng(n_nogood);
 
-    (void) new (home) NoGoodsProp(home,nn.next());
+    NoGoodsProp* ngp =
+      new (home) NoGoodsProp(home,nn.next(),p.ngmax() > 0U);
+    if (p.ngmax() > 0U)
+      const_cast<Path&>(p).ngprops().add(home,*ngp,p.ngmax());
     return ES_OK;
   }
 
@@ -146,8 +146,10 @@ namespace Gecode { namespace Search { namespace Meta { namespace Parallel {
     Statistics stat;
     /// Slave engines
     Slave<Collect>** slaves;
-    /// Number of slave engines
+    /// Number of slave engines still running
     unsigned int n_slaves;
+    /// Number of all slave engines (including finished ones)
+    unsigned int n_all;
     /// Whether a slave has been stopped
     bool slave_stop;
     /// Shared stop flag
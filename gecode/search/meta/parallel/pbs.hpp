@@ -155,6 +155,7 @@ namespace Gecode { namespace Search { namespace Meta { namespace Parallel {
   PBS<Collect>::PBS(Engine** engines, Stop** stops, unsigned int n,
                     const Statistics& stat0)
     : stat(stat0), slaves(heap.alloc<Slave<Collect>*>(n)), n_slaves(n),
+      n_all(n),
       slave_stop(false), tostop(false), n_busy(0) {
     // Initialize slaves
     for (unsigned int i=n_slaves; i--; ) {
@@ -179,13 +180,14 @@ namespace Gecode { namespace Search { namespace Meta { namespace Parallel {
     } else {
       // Delete slave from slaves
       stat += slave->statistics();
-      // Do not actually delete, the thread should do that upon termination
-      slave->todelete(true);
+      // Do not delete yet, the thread might still run the slave
       unsigned int i=0;
       while (slaves[i] != slave)
         i++;
       assert(i < n_slaves);
       slaves[i] = slaves[--n_slaves];
+      // Keep finished slaves after the running ones
+      slaves[n_slaves] = slave;
     }
     if (b) {
       if (--n_busy == 0)
@@ -279,9 +281,9 @@ namespace Gecode { namespace Search { namespace Meta { namespace Parallel {
 
   template<class Collect>
   PBS<Collect>::~PBS(void) {
-    for (unsigned int i=n_slaves; i--; )
+    // All slaves are idle, including the finished ones
+    for (unsigned int i=n_all; i--; )
       delete slaves[i];
-    // Note that n_slaves might be different now!
     heap.rfree(slaves);
   }
 
@@ -44,8 +44,11 @@ namespace Gecode { namespace Search {
       c_d(Config::c_d), a_d(Config::a_d),
       d_l(Config::d_l),
       share_rbs(true), share_pbs(false),
-      assets(0), slice(Config::slice), nogoods_limit(0),
-      stop(NULL), cutoff(NULL) {}
+      assets(0), slice(Config::slice), nogoods_limit(0), nogoods_max(0),
+      eps(0), eps_depth(Config::eps_depth), subproblems(NULL),
+      processes(0), address(NULL), command(NULL),
+      stop(NULL), cutoff(NULL), memory(NULL),
+      scheduling(NULL) {}
 
 }}
 
@@ -66,9 +66,8 @@ namespace Gecode { namespace Search { namespace Parallel {
       delete best;
     }
     best = b.clone();
-    // Announce better solutions
-    for (unsigned int i=0; i<workers(); i++)
-      worker(i)->better(best);
+    // Announce better solution, the workers take it over themselves
+    Support::atomic_store(n_best,n_best+1UL);
     m_search.release();
   }
 
@@ -128,6 +127,11 @@ namespace Gecode { namespace Search { namespace Parallel {
             // Try to find new work
             find();
           } else if (cur != NULL) {
+            better();
+            if (constrain_cur) {
+              cur->constrain(*best);
+              constrain_cur = false;
+            }
             start();
             if (stop(engine().opt())) {
               // Report stop
@@ -135,7 +139,7 @@ namespace Gecode { namespace Search { namespace Parallel {
               engine().stop();
             } else {
               node++;
-              switch (cur->status(*this)) {
+              switch (status()) {
               case SS_FAILED:
                 fail++;
                 delete cur;
@@ -175,6 +179,7 @@ namespace Gecode { namespace Search { namespace Parallel {
               }
             }
           } else if (!path.empty()) {
+            better();
             cur = path.recompute(d,engine().opt().a_d,*this,*best,mark);
             if (cur == NULL)
               path.next();
@@ -213,7 +218,7 @@ namespace Gecode { namespace Search { namespace Parallel {
     n_busy = workers();
     for (unsigned int i=1; i<workers(); i++)
       worker(i)->reset(NULL,0);
-    worker(0)->reset(s,opt().nogoods_limit);
+    worker(0)->reset(subproblems(s,false,NULL),opt().nogoods_limit);
     // Block workers again to ensure invariant
     block();
     // Release reset lock
@@ -236,7 +241,7 @@ namespace Gecode { namespace Search { namespace Parallel {
     release(C_RESET);
     // Wait for reset cycle started
     e_reset_ack_start.wait();
-    ng = &worker(0)->nogoods();
+    ng = &wng;
     // Block workers again to ensure invariant
     block();
     // Release reset lock
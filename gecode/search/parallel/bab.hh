@@ -52,6 +52,10 @@ namespace Gecode { namespace Search { namespace Parallel {
       int mark;
       /// Best solution found so far
       Space* best;
+      /// Number of the engine's best solution that \a best corresponds to
+      unsigned long int n_best;
+      /// Whether the current space must still be constrained by best
+      bool constrain_cur;
     public:
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, BAB& e);
@@ -59,8 +63,8 @@ namespace Gecode { namespace Search { namespace Parallel {
       BAB& engine(void) const;
       /// Start execution of worker
       virtual void run(void);
-      /// Accept better solution \a b
-      void better(Space* b);
+      /// Take over the engine's best solution if it has changed
+      void better(void);
       /// Try to find some work
       void find(void);
       /// Reset engine to restart at space \a s
@@ -72,6 +76,13 @@ namespace Gecode { namespace Search { namespace Parallel {
     Worker** _worker;
     /// Best solution so far
     Space* best;
+    /**
+     * \brief Number of best solutions so far
+     *
+     * Changed with the search mutex held, but read by the workers
+     * without synchronization before they explore a node.
+     */
+    unsigned long int n_best;
   public:
     /// Provide access to worker \a i
     Worker* worker(unsigned int i) const;
@@ -123,6 +134,7 @@ namespace Gecode { namespace Search { namespace Parallel {
     d = 0;
     mark = 0;
     idle = false;
+    constrain_cur = false;
     if ((s == NULL) || (s->status(*this) == SS_FAILED)) {
       delete s;
       cur = NULL;
@@ -138,19 +150,23 @@ namespace Gecode { namespace Search { namespace Parallel {
    */
   forceinline
   BAB::Worker::Worker(Space* s, BAB& e)
-    : Engine::Worker(s,e), mark(0), best(NULL) {}
+    : Engine::Worker(s,e), mark(0), best(NULL), n_best(0UL),
+      constrain_cur(false) {}
 
   forceinline
   BAB::BAB(Space* s, const Options& o)
-    : Engine(o), best(NULL) {
+    : Engine(o), best(NULL), n_best(0UL) {
     // Create workers
     _worker = static_cast<Worker**>
       (heap.ralloc(workers() * sizeof(Worker*)));
-    // The first worker gets the entire search tree
-    _worker[0] = new Worker(s,*this);
+    // The first worker gets the entire search tree (unless decomposed)
+    _worker[0] = new Worker(subproblems(s,true,opt().subproblems),*this);
     // All other workers start with no work
     for (unsigned int i=1; i<workers(); i++)
       _worker[i] = new Worker(NULL,*this);
+    // Collect the no-goods of all workers
+    for (unsigned int i=0; i<workers(); i++)
+      wng.worker(i,_worker[i]->nogoods());
     // Block all workers
     block();
     // Create and start threads
@@ -163,14 +179,19 @@ namespace Gecode { namespace Search { namespace Parallel {
    * Engine: search control
    */
   forceinline void
-  BAB::Worker::better(Space* b) {
-    m.acquire();
+  BAB::Worker::better(void) {
+    BAB& e = engine();
+    // Quick check without locking
+    if (Support::atomic_load(e.n_best) == n_best)
+      return;
+    e.m_search.acquire();
     delete best;
-    best = b->clone(false);
-    mark = path.entries();
-    if (cur != NULL)
-      cur->constrain(*best);
-    m.release();
+    best = (e.best != NULL) ? e.best->clone(false) : NULL;
+    n_best = e.n_best;
+    e.m_search.release();
+    mark = (best != NULL) ? path.entries() : 0;
+    // The current space is constrained before it is explored further
+    constrain_cur = (cur != NULL) && (best != NULL);
   }
   forceinline void
   BAB::solution(Space* s) {
@@ -188,9 +209,8 @@ namespace Gecode { namespace Search { namespace Parallel {
     } else {
       best = s->clone();
     }
-    // Announce better solutions
-    for (unsigned int i=0; i<workers(); i++)
-      worker(i)->better(best);
+    // Announce better solution, the workers take it over themselves
+    Support::atomic_store(n_best,n_best+1UL);
     bool bs = signal();
     solutions.push(s);
     if (bs)
@@ -204,25 +224,34 @@ namespace Gecode { namespace Search { namespace Parallel {
    */
   forceinline void
   BAB::Worker::find(void) {
-    // Try to find new work (even if there is none)
-    for (unsigned int i=0; i<engine().workers(); i++) {
-      unsigned long int r_d = 0ul;
-      if (Space* s = engine().worker(i)->steal(r_d)) {
-        // Reset this guy
-        m.acquire();
-        idle = false;
-        // Not idle but also does not have the root of the tree
-        path.ngdl(0);
-        d = 0;
-        cur = s;
-        mark = 0;
-        if (best != NULL)
-          cur->constrain(*best);
-        Search::Worker::reset(r_d);
-        m.release();
-        return;
-      }
+    unsigned long int r_d = 0ul;
+    // Take a subproblem before trying to steal work
+    Space* s = engine().subproblem(path,r_d);
+    // Try to find new work (even if there is none), start at random victim
+    unsigned int n = engine().workers();
+    unsigned int v = victim();
+    for (unsigned int i=0; (s == NULL) && (i<n);
+         i++, v = (v+1 < n) ? v+1 : 0)
+      if (engine().worker(v) != this)
+        s = engine().worker(v)->steal(r_d,path);
+    if (s == NULL) {
+      backoff();
+      return;
     }
+    // Reset this guy
+    m.acquire();
+    idle = false;
+    n_unsuccessful = 0;
+    // The path has been connected to the root (if possible)
+    d = 0;
+    cur = s;
+    mark = 0;
+    better();
+    if (best != NULL)
+      cur->constrain(*best);
+    constrain_cur = false;
+    Search::Worker::reset(r_d);
+    m.release();
   }
 
 }}}
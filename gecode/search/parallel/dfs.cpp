@@ -113,7 +113,7 @@ namespace Gecode { namespace Search { namespace Parallel {
               engine().stop();
             } else {
               node++;
-              switch (cur->status(*this)) {
+              switch (status()) {
               case SS_FAILED:
                 fail++;
                 delete cur;
@@ -189,7 +189,7 @@ namespace Gecode { namespace Search { namespace Parallel {
     n_busy = workers();
     for (unsigned int i=1U; i<workers(); i++)
       worker(i)->reset(NULL,0);
-    worker(0U)->reset(s,opt().nogoods_limit);
+    worker(0U)->reset(subproblems(s,false,NULL),opt().nogoods_limit);
     // Block workers again to ensure invariant
     block();
     // Release reset lock
@@ -213,7 +213,7 @@ namespace Gecode { namespace Search { namespace Parallel {
     release(C_RESET);
     // Wait for reset cycle started
     e_reset_ack_start.wait();
-    ng = &worker(0)->nogoods();
+    ng = &wng;
     // Block workers again to ensure invariant
     block();
     // Release reset lock
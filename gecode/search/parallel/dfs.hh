@@ -112,11 +112,14 @@ namespace Gecode { namespace Search { namespace Parallel {
     // Create workers
     _worker = static_cast<Worker**>
       (heap.ralloc(workers() * sizeof(Worker*)));
-    // The first worker gets the entire search tree
-    _worker[0] = new Worker(s,*this);
+    // The first worker gets the entire search tree (unless decomposed)
+    _worker[0] = new Worker(subproblems(s,true,opt().subproblems),*this);
     // All other workers start with no work
     for (unsigned int i=1; i<workers(); i++)
       _worker[i] = new Worker(NULL,*this);
+    // Collect the no-goods of all workers
+    for (unsigned int i=0; i<workers(); i++)
+      wng.worker(i,_worker[i]->nogoods());
     // Block all workers
     block();
     // Create and start threads
@@ -163,22 +166,29 @@ namespace Gecode { namespace Search { namespace Parallel {
    */
   forceinline void
   DFS::Worker::find(void) {
-    // Try to find new work (even if there is none)
-    for (unsigned int i=0; i<engine().workers(); i++) {
-      unsigned long int r_d = 0ul;
-      if (Space* s = engine().worker(i)->steal(r_d)) {
-        // Reset this guy
-        m.acquire();
-        idle = false;
-        // Not idle but also does not have the root of the tree
-        path.ngdl(0);
-        d = 0;
-        cur = s;
-        Search::Worker::reset(r_d);
-        m.release();
-        return;
-      }
+    unsigned long int r_d = 0ul;
+    // Take a subproblem before trying to steal work
+    Space* s = engine().subproblem(path,r_d);
+    // Try to find new work (even if there is none), start at random victim
+    unsigned int n = engine().workers();
+    unsigned int v = victim();
+    for (unsigned int i=0; (s == NULL) && (i<n);
+         i++, v = (v+1 < n) ? v+1 : 0)
+      if (engine().worker(v) != this)
+        s = engine().worker(v)->steal(r_d,path);
+    if (s == NULL) {
+      backoff();
+      return;
     }
+    // Reset this guy
+    m.acquire();
+    idle = false;
+    n_unsuccessful = 0;
+    // The path has been connected to the root (if possible)
+    d = 0;
+    cur = s;
+    Search::Worker::reset(r_d);
+    m.release();
   }
 
 }}}
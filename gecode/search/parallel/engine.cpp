@@ -97,6 +97,77 @@ namespace Gecode { namespace Search { namespace Parallel {
     return NULL;
   }
 
+  /*
+   * Embarrassingly parallel search
+   */
+  Space*
+  Engine::subproblems(Space* s, bool c, const Subproblems* sp) {
+    delete eps_root;
+    eps_root = NULL;
+    eps_next = eps_left = 0;
+    if ((s == NULL) || ((opt().eps == 0U) && (sp == NULL)) ||
+        (s->status() == SS_FAILED))
+      return s;
+    Space* r = c ? snapshot(s,opt(),false) : s;
+    if (sp != NULL)
+      eps_sp = *sp;
+    else
+      eps_sp.decompose(*r,opt().eps*workers(),opt().eps_depth);
+    if (eps_sp.size() == 0) {
+      // All nodes have failed during decomposition
+      delete r;
+      return NULL;
+    }
+    eps_root = r;
+    eps_left = eps_sp.size();
+    // The pending subproblems count as one busy worker
+    n_busy++;
+    return NULL;
+  }
+
+  Space*
+  Engine::subproblem(Path& p, unsigned long int& d) {
+    // Quick check without locking
+    if (Support::atomic_load(eps_left) == 0)
+      return NULL;
+    m_eps.acquire();
+    if (eps_left == 0) {
+      m_eps.release();
+      return NULL;
+    }
+    int i = eps_next++;
+    Support::atomic_store(eps_left,eps_left-1);
+    // Cloning must be exclusive as it updates the root space
+    Space* s = eps_root->clone(false);
+    // The worker taking the last subproblem takes over its busy count
+    if (eps_left > 0)
+      busy();
+    m_eps.release();
+    unsigned int n = eps_sp.commit(*s,i);
+    p.subproblem(eps_sp[i],n,opt().nogoods_limit);
+    d = n;
+    return s;
+  }
+
+
+  /*
+   * No-goods
+   */
+  void
+  Engine::WorkerNoGoods::post(Space& home) const {
+    unsigned long int m = 0UL;
+    for (unsigned int i=0U; (i<n) && !home.failed(); i++) {
+      w[i]->ng(0);
+      w[i]->post(home);
+      m += w[i]->ng();
+    }
+    const_cast<WorkerNoGoods&>(*this).ng(m);
+  }
+
+  Engine::WorkerNoGoods::~WorkerNoGoods(void) {
+    heap.free<NoGoods*>(w,n);
+  }
+
   /*
    * Termination and deletion
    */
@@ -105,6 +176,10 @@ namespace Gecode { namespace Search { namespace Parallel {
     path.reset(0);
   }
 
+  Engine::~Engine(void) {
+    delete eps_root;
+  }
+
 }}}
 
 #endif
@@ -48,7 +48,17 @@ namespace Gecode { namespace Search { namespace Parallel {
   /// %Parallel depth-first search engine
   class Engine : public Search::Engine {
   protected:
-    /// %Parallel depth-first search worker
+    /**
+     * \brief %Parallel depth-first search worker
+     *
+     * The mutex of a worker protects its path (and its statistics).
+     * It is released while the current space is being propagated
+     * (see status()), but it is held while the path is changed.
+     * This includes cloning a space for the path or for a solution
+     * and recomputing a space from the path, where recomputation
+     * might propagate several spaces. If the mutex is taken, an idle
+     * worker does not block but tries the next victim.
+     */
     class Worker : public Search::Worker, public Support::Runnable {
     protected:
       /// Reference to engine
@@ -63,11 +73,21 @@ namespace Gecode { namespace Search { namespace Parallel {
       unsigned int d;
       /// Whether the worker is idle
       bool idle;
+      /// Random number generator for selecting victims
+      Support::RandomGenerator rnd;
+      /// Number of consecutive unsuccessful attempts to find work
+      unsigned int n_unsuccessful;
+      /// Return first victim for finding work
+      unsigned int victim(void);
+      /// Back off after an unsuccessful attempt to find work
+      void backoff(void);
+      /// Propagate current space (without holding the mutex)
+      SpaceStatus status(void);
     public:
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, Engine& e);
-      /// Hand over some work (NULL if no work available)
-      Space* steal(unsigned long int& d);
+      /// Hand over some work (NULL if no work available) for thief path \a t
+      Space* steal(unsigned long int& d, Path& t);
       /// Return statistics
       Statistics statistics(void);
       /// Provide access to engine
@@ -182,6 +202,66 @@ namespace Gecode { namespace Search { namespace Parallel {
     void stop(void);
     //@}
 
+    /// \name No-goods
+    //@{
+  protected:
+    /// No-goods from the paths of all workers
+    class WorkerNoGoods : public NoGoods {
+    protected:
+      /// No-goods of the workers
+      NoGoods** w;
+      /// Number of workers
+      unsigned int n;
+    public:
+      /// Initialize for \a n workers
+      WorkerNoGoods(unsigned int n);
+      /// %Set no-goods of worker \a i to \a ng
+      void worker(unsigned int i, NoGoods& ng);
+      /// Post no-goods of all workers
+      virtual void post(Space& home) const;
+      /// Destructor
+      virtual ~WorkerNoGoods(void);
+    };
+    /// No-goods of all workers
+    WorkerNoGoods wng;
+    /// No-good propagators posted by all workers
+    Meta::NoGoodsProps ngps;
+    //@}
+
+    /// \name Embarrassingly parallel search
+    //@{
+  protected:
+    /// Mutex for dispatching subproblems
+    Support::Mutex m_eps;
+    /// Root space for recomputing subproblems (NULL if there are none)
+    Space* eps_root;
+    /// Subproblems of the root space
+    Subproblems eps_sp;
+    /// Next subproblem to be dispatched
+    int eps_next;
+    /// Number of subproblems not yet dispatched
+    int eps_left;
+    /**
+     * \brief Decompose space \a s into subproblems
+     *
+     * Returns the space the first worker starts from: either \a s
+     * or NULL if \a s has been decomposed into subproblems. If \a c
+     * is true, \a s is cloned according to the options before it is
+     * kept as root space. If \a sp is not NULL, its subproblems are
+     * used instead of decomposing \a s.
+     */
+    Space* subproblems(Space* s, bool c, const Subproblems* sp);
+  public:
+    /**
+     * \brief Return next subproblem (NULL if there is none)
+     *
+     * The path \a p of the worker is started at the subproblem and
+     * \a d is set to its depth.
+     */
+    Space* subproblem(Path& p, unsigned long int& d);
+    //@}
+
+  public:
     /// \name Engine interface
     //@{
     /// Initialize with options \a o
@@ -190,6 +270,8 @@ namespace Gecode { namespace Search { namespace Parallel {
     virtual Space* next(void);
     /// Check whether engine has been stopped
     virtual bool stopped(void) const;
+    /// Destructor
+    virtual ~Engine(void);
     //@}
   };
 
@@ -246,7 +328,9 @@ namespace Gecode { namespace Search { namespace Parallel {
   Engine::Worker::Worker(Space* s, Engine& e)
     : _engine(e),
       path(s == NULL ? 0 : e.opt().nogoods_limit), d(0),
-      idle(false) {
+      idle(false), rnd(Support::hwrnd()), n_unsuccessful(0U) {
+    path.ngmax(e.opt().nogoods_max);
+    path.ngprops(e.ngps);
     if (s != NULL) {
       if (s->status(*this) == SS_FAILED) {
         fail++;
@@ -261,9 +345,20 @@ namespace Gecode { namespace Search { namespace Parallel {
     }
   }
 
+  forceinline
+  Engine::WorkerNoGoods::WorkerNoGoods(unsigned int n0)
+    : w(heap.alloc<NoGoods*>(n0)), n(n0) {}
+  forceinline void
+  Engine::WorkerNoGoods::worker(unsigned int i, NoGoods& ng) {
+    assert(i < n);
+    w[i] = &ng;
+  }
+
   forceinline
   Engine::Engine(const Options& o)
-    : _opt(o), solutions(heap) {
+    : _opt(o), solutions(heap),
+      wng(static_cast<unsigned int>(o.threads)),
+      eps_root(NULL), eps_next(0), eps_left(0) {
     // Initialize termination information
     _n_term_not_ack = workers();
     _n_not_terminated = workers();
@@ -394,11 +489,38 @@ namespace Gecode { namespace Search { namespace Parallel {
 
 
 
+  /*
+   * Worker: exploration
+   */
+  forceinline SpaceStatus
+  Engine::Worker::status(void) {
+    /*
+     * The current space is not reachable from the path, so no other
+     * worker can access it while it is being propagated.
+     */
+    StatusStatistics ss;
+    m.release();
+    SpaceStatus s = cur->status(ss);
+    m.acquire();
+    StatusStatistics::operator +=(ss);
+    return s;
+  }
+
+
   /*
    * Worker: finding and stealing working
    */
+  forceinline unsigned int
+  Engine::Worker::victim(void) {
+    return rnd(engine().workers());
+  }
+  forceinline void
+  Engine::Worker::backoff(void) {
+    if (++n_unsuccessful > Config::steal_spin)
+      Support::Thread::sleep(Config::steal_backoff);
+  }
   forceinline Space*
-  Engine::Worker::steal(unsigned long int& d) {
+  Engine::Worker::steal(unsigned long int& d, Path& t) {
     /*
      * Make a quick check whether the worker might have work
      *
@@ -407,12 +529,21 @@ namespace Gecode { namespace Search { namespace Parallel {
      */
     if (!path.steal())
       return NULL;
-    m.acquire();
-    Space* s = path.steal(*this,d);
-    m.release();
-    // Tell that there will be one more busy worker
+    /*
+     * Do not wait for a busy victim: the mutex might be held during
+     * cloning or recomputation and the worker will be asked again
+     * eventually.
+     */
+    if (!m.tryacquire())
+      return NULL;
+    Space* s = path.steal(*this,d,t,engine().opt().nogoods_limit);
+    /*
+     * Tell that there will be one more busy worker before the victim
+     * can report to be idle, otherwise the engine might terminate.
+     */
     if (s != NULL)
       engine().busy();
+    m.release();
     return s;
   }
 
@@ -39,9 +39,81 @@
 
 namespace Gecode { namespace Search { namespace Parallel {
 
+  /// Release the literals \a l
+  forceinline void
+  release(Space& home, Support::DynamicArray<NGL*,Region>& l, int n) {
+    for (int i=0; i<n; i++)
+      home.rfree(l[i],l[i]->dispose(home));
+  }
+
+  /// Add literal \a ngl to \a l, return false if it is failed
+  forceinline bool
+  add(Space& home, Support::DynamicArray<NGL*,Region>& l, int& n, NGL* ngl) {
+    switch (ngl->status(home)) {
+    case NGL::FAILED:
+      home.rfree(ngl,ngl->dispose(home));
+      return false;
+    case NGL::SUBSUMED:
+      home.rfree(ngl,ngl->dispose(home));
+      break;
+    case NGL::NONE:
+      l[n++] = ngl;
+      break;
+    default:
+      GECODE_NEVER;
+    }
+    return true;
+  }
+
   void
   Path::post(Space& home) const {
-    GECODE_ES_FAIL(Meta::NoGoodsProp::post(home,*this));
+    if (n_pf == 0) {
+      GECODE_ES_FAIL(Meta::NoGoodsProp::post(home,*this));
+    } else if ((n_pf > 0) && !ds.empty()) {
+      // Create literals for the alternatives leading to the path
+      Region r(home);
+      /*
+       * Plain and negated literals: plain literals come first as only
+       * they can be pruned when they become the root of the no-goods.
+       */
+      Support::DynamicArray<NGL*,Region> l(r,n_pf), nl(r,n_pf);
+      int n = 0, nn = 0;
+      Archive e(*pf);
+      for (int i=0; i<n_pf; i++) {
+        unsigned int a; e >> a;
+        const Choice* c;
+        try {
+          c = home.choice(e);
+        } catch (SpaceNoBrancher&) {
+          // The brancher has been created after the root
+          release(home,l,n); release(home,nl,nn);
+          return;
+        }
+        bool ok = true;
+        if (NGL* ngl = home.ngl(*c,a)) {
+          ok = add(home,l,n,ngl);
+        } else if ((a > 0U) && (a+1U == c->alternatives())) {
+          // The last alternative holds if no other alternative holds
+          for (unsigned int b=0U; ok && (b<a); b++)
+            if (NGL* ngl = home.ngl(*c,b))
+              ok = add(home,nl,nn,new (home) Meta::NegNGL(home,ngl));
+            else
+              ok = false;
+        } else {
+          // The brancher does not support no-goods
+          ok = false;
+        }
+        delete c;
+        if (!ok) {
+          // Either no literal or the stolen subtree is not part of the tree
+          release(home,l,n); release(home,nl,nn);
+          return;
+        }
+      }
+      for (int i=0; i<nn; i++)
+        l[n++] = nl[i];
+      GECODE_ES_FAIL(Meta::NoGoodsProp::post(home,*this,l,n));
+    }
   }
 
 }}}
@@ -111,6 +111,21 @@ namespace Gecode { namespace Search { namespace Parallel {
     unsigned int _ngdl;
     /// Number of edges that have work for stealing
     unsigned int n_work;
+    /// Whether work has been stolen from the path
+    bool stolen;
+    /// Alternatives and choices from the root to the start of the path
+    Archive* pf;
+    /// Number of choices in \a pf (negative if the path is not connected)
+    int n_pf;
+    /// No-good propagators posted (shared by all workers)
+    Meta::NoGoodsProps* ngps;
+    /**
+     * \brief Initialize prefix for stealing alternative \a a at depth \a n
+     *
+     * The prefix extends the prefix of the victim's path \a v by its
+     * first \a n edges. \a l is the no-good depth limit.
+     */
+    void prefix(const Path& v, int n, unsigned int a, unsigned int l);
   public:
     /// Initialize with no-good depth limit \a l
     Path(unsigned int l);
@@ -118,6 +133,10 @@ namespace Gecode { namespace Search { namespace Parallel {
     unsigned int ngdl(void) const;
     /// Set no-good depth limit to \a l
     void ngdl(unsigned int l);
+    /// Return no-good propagators posted
+    Meta::NoGoodsProps& ngprops(void);
+    /// %Set no-good propagators posted to \a p
+    void ngprops(Meta::NoGoodsProps& p);
     /// Push space \a c (a clone of \a s or NULL)
     const Choice* push(Worker& stat, Space* s, Space* c);
     /// Generate path for next node
@@ -143,8 +162,20 @@ namespace Gecode { namespace Search { namespace Parallel {
     void reset(unsigned int l);
     /// Make a quick check whether stealing might be feasible
     bool steal(void) const;
-    /// Steal work at depth \a d
-    Space* steal(Worker& stat, unsigned long int& d);
+    /**
+     * \brief Steal work at depth \a d
+     *
+     * The path \a t of the thief is initialized such that it can
+     * extract no-goods up to depth \a m (counted from the root).
+     */
+    Space* steal(Worker& stat, unsigned long int& d, Path& t, unsigned int m);
+    /**
+     * \brief Start path at subproblem \a s with \a n choices
+     *
+     * The path can extract no-goods up to depth \a l (counted from
+     * the root).
+     */
+    void subproblem(const Archive& s, unsigned int n, unsigned int l);
     /// Post no-goods
     void virtual post(Space& home) const;
   };
@@ -223,7 +254,8 @@ namespace Gecode { namespace Search { namespace Parallel {
 
   forceinline
   Path::Path(unsigned int l)
-    : ds(heap), _ngdl(l), n_work(0) {}
+    : ds(heap), _ngdl(l), n_work(0), stolen(false),
+      pf(NULL), n_pf((l > 0U) ? 0 : -1), ngps(NULL) {}
 
   forceinline unsigned int
   Path::ngdl(void) const {
@@ -235,6 +267,17 @@ namespace Gecode { namespace Search { namespace Parallel {
     _ngdl = l;
   }
 
+  forceinline Meta::NoGoodsProps&
+  Path::ngprops(void) {
+    assert(ngps != NULL);
+    return *ngps;
+  }
+
+  forceinline void
+  Path::ngprops(Meta::NoGoodsProps& p) {
+    ngps = &p;
+  }
+
   forceinline const Choice*
   Path::push(Worker& stat, Space* s, Space* c) {
     if (!ds.empty() && ds.top().lao()) {
@@ -256,6 +299,12 @@ namespace Gecode { namespace Search { namespace Parallel {
         ds.pop().dispose();
       } else {
         assert(ds.top().work());
+        /*
+         * Work below the current alternative might have been stolen,
+         * so it cannot be used as no-good.
+         */
+        if (stolen)
+          ngdl(std::min(ngdl(),static_cast<unsigned int>(ds.entries()-1)));
         ds.top().next();
         if (!ds.top().work())
           n_work--;
@@ -308,9 +357,12 @@ namespace Gecode { namespace Search { namespace Parallel {
   forceinline void
   Path::reset(unsigned int l) {
     n_work = 0;
+    stolen = false;
     while (!ds.empty())
       ds.pop().dispose();
     _ngdl = l;
+    delete pf; pf = NULL;
+    n_pf = (l > 0U) ? 0 : -1;
   }
 
   forceinline bool
@@ -318,8 +370,47 @@ namespace Gecode { namespace Search { namespace Parallel {
     return n_work > Config::steal_limit;
   }
 
+  forceinline void
+  Path::prefix(const Path& v, int n, unsigned int a, unsigned int l) {
+    delete pf; pf = NULL;
+    n_pf = -1; _ngdl = 0U;
+    /*
+     * The victim must be connected, its edges up to n must be complete
+     * (edges beyond the no-good depth limit might have been removed by
+     * LAO), and the thief must have some depth left.
+     */
+    if ((v.n_pf < 0) || (static_cast<unsigned int>(n) >= v.ngdl()) ||
+        (static_cast<unsigned int>(v.n_pf+n+1) >= l))
+      return;
+    pf = (v.pf != NULL) ? new Archive(*v.pf) : new Archive;
+    for (int i=0; i<n; i++) {
+      assert(!v.ds[i].lao());
+      *pf << v.ds[i].alt();
+      v.ds[i].choice()->archive(*pf);
+    }
+    *pf << a;
+    v.ds[n].choice()->archive(*pf);
+    n_pf = v.n_pf+n+1;
+    _ngdl = l - static_cast<unsigned int>(n_pf);
+  }
+
+  forceinline void
+  Path::subproblem(const Archive& s, unsigned int n, unsigned int l) {
+    assert(ds.empty());
+    delete pf; pf = NULL;
+    n_pf = -1; _ngdl = 0U;
+    if (n >= l)
+      return;
+    // Skip the number of choices
+    pf = new Archive;
+    for (int i=1; i<s.size(); i++)
+      pf->put(s[i]);
+    n_pf = static_cast<int>(n);
+    _ngdl = l - n;
+  }
+
   forceinline Space*
-  Path::steal(Worker& stat, unsigned long int& d) {
+  Path::steal(Worker& stat, unsigned long int& d, Path& t, unsigned int m) {
     // Find position to steal: leave sufficient work
     int n = ds.entries()-1;
     unsigned int w = 0;
@@ -336,11 +427,15 @@ namespace Gecode { namespace Search { namespace Parallel {
         // Recompute, if necessary
         for (int i=l; i<n; i++)
           commit(c,i);
-        c->commit(*ds[n].choice(),ds[n].steal());
+        unsigned int a = ds[n].steal();
+        c->commit(*ds[n].choice(),a);
         if (!ds[n].work())
           n_work--;
+        // The thief can extract no-goods below n
+        t.prefix(*this,n,a,m);
         // No no-goods can be extracted above n
         ngdl(std::min(ngdl(),static_cast<unsigned int>(n)));
+        stolen = true;
         d = stat.steal_depth(static_cast<unsigned long int>(n+1));
         return c;
       }
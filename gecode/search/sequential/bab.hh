@@ -84,6 +84,7 @@ namespace Gecode { namespace Search { namespace Sequential {
   forceinline
   BAB::BAB(Space* s, const Options& o)
     : opt(o), path(opt.nogoods_limit), d(0), mark(0), best(NULL) {
+    path.ngmax(opt.nogoods_max);
     if ((s == NULL) || (s->status(*this) == SS_FAILED)) {
       fail++;
       cur = NULL;
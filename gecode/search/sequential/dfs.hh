@@ -76,6 +76,7 @@ namespace Gecode { namespace Search { namespace Sequential {
   forceinline
   DFS::DFS(Space* s, const Options& o)
     : opt(o), path(opt.nogoods_limit), d(0) {
+    path.ngmax(opt.nogoods_max);
     if ((s == NULL) || (s->status(*this) == SS_FAILED)) {
       fail++;
       cur = NULL;
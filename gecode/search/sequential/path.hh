@@ -105,6 +105,8 @@ namespace Gecode { namespace Search { namespace Sequential {
     Support::DynamicStack<Edge,Heap> ds;
     /// Depth limit for no-good generation
     unsigned int _ngdl;
+    /// No-good propagators posted (if their number is limited)
+    Meta::NoGoodsProps ngps;
   public:
     /// Initialize with no-good depth limit \a l
     Path(unsigned int l);
@@ -112,6 +114,8 @@ namespace Gecode { namespace Search { namespace Sequential {
     unsigned int ngdl(void) const;
     /// Set no-good depth limit to \a l
     void ngdl(unsigned int l);
+    /// Return no-good propagators posted
+    Meta::NoGoodsProps& ngprops(void);
     /// Push space \a c (a clone of \a s or NULL)
     const Choice* push(Worker& stat, Space* s, Space* c);
     /// Generate path for next node
@@ -218,6 +222,11 @@ namespace Gecode { namespace Search { namespace Sequential {
     _ngdl = l;
   }
 
+  forceinline Meta::NoGoodsProps&
+  Path::ngprops(void) {
+    return ngps;
+  }
+
   forceinline const Choice*
   Path::push(Worker& stat, Space* s, Space* c) {
     if (!ds.empty() && ds.top().lao()) {
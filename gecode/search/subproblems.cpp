@@ -0,0 +1,139 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search.hh>
+
+namespace Gecode { namespace Search {
+
+  Subproblems::Subproblems(Archive& e)
+    : sp(heap), n(0) {
+    unsigned int m; e >> m;
+    for (unsigned int i=0U; i<m; i++) {
+      unsigned int k; e >> k;
+      Archive a;
+      for (unsigned int j=0U; j<k; j++) {
+        unsigned int v; e >> v;
+        a << v;
+      }
+      add(a);
+    }
+  }
+
+  void
+  Subproblems::archive(Archive& e) const {
+    e << static_cast<unsigned int>(n);
+    for (int i=0; i<n; i++) {
+      e << static_cast<unsigned int>(sp[i].size());
+      for (int j=0; j<sp[i].size(); j++)
+        e << sp[i][j];
+    }
+  }
+
+  void
+  Subproblems::decompose(Space& s, unsigned int m, unsigned int d) {
+    n = 0;
+    if (s.status() == SS_FAILED)
+      return;
+    /*
+     * Open nodes of the current and the next level: the (propagated)
+     * spaces, the alternatives and choices leading to them, and the
+     * number of choices.
+     */
+    Support::DynamicArray<Space*,Heap> cs(heap), ns(heap);
+    Support::DynamicArray<Archive,Heap> ca(heap), na(heap);
+    Support::DynamicArray<unsigned int,Heap> ck(heap), nk(heap);
+    int c = 1;
+    cs[0] = s.clone(false); ck[0] = 0U;
+    for (unsigned int l=0U; (l < d) && (static_cast<unsigned int>(c) < m); l++) {
+      int k = 0;
+      bool b = false;
+      for (int i=0; i<c; i++)
+        if (cs[i]->status() == SS_BRANCH) {
+          b = true;
+          const Choice* ch = cs[i]->choice();
+          unsigned int alt = ch->alternatives();
+          for (unsigned int a=0U; a<alt; a++) {
+            Space* t = (a+1U < alt) ? cs[i]->clone(false) : cs[i];
+            t->commit(*ch,a);
+            if (t->status() == SS_FAILED) {
+              delete t;
+            } else {
+              ns[k] = t; na[k] = ca[i]; nk[k] = ck[i]+1U;
+              na[k] << a;
+              ch->archive(na[k]);
+              k++;
+            }
+          }
+          delete ch;
+        } else {
+          // Solved nodes are kept as they are
+          ns[k] = cs[i]; na[k] = ca[i]; nk[k] = ck[i];
+          k++;
+        }
+      for (int i=0; i<k; i++) {
+        cs[i] = ns[i]; ca[i] = na[i]; ck[i] = nk[i];
+      }
+      c = k;
+      if (!b)
+        break;
+    }
+    for (int i=0; i<c; i++) {
+      Archive e;
+      e << ck[i];
+      for (int j=0; j<ca[i].size(); j++)
+        e << ca[i][j];
+      add(e);
+      delete cs[i];
+    }
+  }
+
+  unsigned int
+  Subproblems::commit(Space& s, int i) const {
+    Archive e((*this)[i]);
+    unsigned int k; e >> k;
+    for (unsigned int j=0U; j<k; j++) {
+      unsigned int a; e >> a;
+      const Choice* c = s.choice(e);
+      s.commit(*c,a);
+      delete c;
+    }
+    return k;
+  }
+
+}}
+
+// STATISTICS: search-other
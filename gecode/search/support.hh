@@ -73,7 +73,12 @@ namespace Gecode { namespace Search {
 
   forceinline Space*
   snapshot(Space* s, const Options& o, bool share) {
-    return o.clone ? s->clone(share) : s;
+    Space* c = o.clone ? s->clone(share) : s;
+    if (o.memory != NULL)
+      c->memory(*o.memory);
+    if (o.scheduling != NULL)
+      c->scheduling(*o.scheduling);
+    return c;
   }
 
 
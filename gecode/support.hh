@@ -141,6 +141,7 @@
 #endif
 
 #include <gecode/support/thread/thread.hpp>
+#include <gecode/support/atomic.hpp>
 
 #include <gecode/support/timer.hpp>
 #include <gecode/support/hw-rnd.hpp>
@@ -0,0 +1,294 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#if defined(__clang__) || \
+  (defined(__GNUC__) && ((__GNUC__ > 4) || \
+                         ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 7))))
+/// Whether atomic operations are implemented by compiler builtins
+#define GECODE_HAS_ATOMICS
+#endif
+
+#if !defined(GECODE_HAS_ATOMICS) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * \defgroup FuncSupportAtomic Atomic operations
+ *
+ * Minimal support for atomic operations on memory shared between
+ * threads, just enough for the synchronization-free parts of parallel
+ * search and of globally shared propagator information.
+ *
+ * If the compiler supports atomic builtins, the macro GECODE_HAS_ATOMICS
+ * is defined and all operations are lock-free (provided the hardware
+ * supports lock-free operations of the respective size). Otherwise, all
+ * operations are still available but are synchronized by a single
+ * global mutex. The only exception are additions and subtractions of
+ * unsigned integers (as used for reference counts), which are
+ * implemented by interlocked operations with Microsoft compilers.
+ *
+ * \ingroup FuncSupportThread
+ */
+
+namespace Gecode { namespace Support {
+
+#ifndef GECODE_HAS_ATOMICS
+  /// Mutex for synchronizing atomic operations if not supported otherwise
+  GECODE_SUPPORT_EXPORT FastMutex& atomic_mutex(void);
+#endif
+
+  /**
+   * \brief Return value of \a x with acquire semantics
+   * \ingroup FuncSupportAtomic
+   */
+  template<class T>
+  T atomic_load(const T& x);
+  /**
+   * \brief Return value of \a x without ordering constraints
+   * \ingroup FuncSupportAtomic
+   */
+  template<class T>
+  T atomic_relaxed_load(const T& x);
+  /**
+   * \brief Store \a v in \a x with release semantics
+   * \ingroup FuncSupportAtomic
+   */
+  template<class T>
+  void atomic_store(T& x, T v);
+  /**
+   * \brief Store \a v in \a x without ordering constraints
+   * \ingroup FuncSupportAtomic
+   */
+  template<class T>
+  void atomic_relaxed_store(T& x, T v);
+  /**
+   * \brief Store \a d in \a x if \a x is equal to \a e
+   *
+   * Returns true if successful. Otherwise \a e is updated to the
+   * current value of \a x and false is returned.
+   * \ingroup FuncSupportAtomic
+   */
+  template<class T>
+  bool atomic_cas(T& x, T& e, T d);
+  /**
+   * \brief Atomically add \a d to integer \a x and return new value
+   * \ingroup FuncSupportAtomic
+   */
+  template<class T>
+  T atomic_add(T& x, T d);
+  /**
+   * \brief Atomically subtract \a d from integer \a x and return new value
+   * \ingroup FuncSupportAtomic
+   */
+  template<class T>
+  T atomic_sub(T& x, T d);
+  /**
+   * \brief Atomically add \a d to integer \a x without ordering constraints
+   *
+   * Suitable for counters that are only read after all updates
+   * have been synchronized otherwise.
+   * \ingroup FuncSupportAtomic
+   */
+  template<class T>
+  void atomic_relaxed_add(T& x, T d);
+  /**
+   * \brief Atomically add \a d to \a x and return new value
+   * \ingroup FuncSupportAtomic
+   */
+  double atomic_add(double& x, double d);
+  /**
+   * \brief Full memory barrier
+   * \ingroup FuncSupportAtomic
+   */
+  void atomic_fence(void);
+
+
+#ifdef GECODE_HAS_ATOMICS
+
+  template<class T>
+  forceinline T
+  atomic_load(const T& x) {
+    T v;
+    __atomic_load(&x,&v,__ATOMIC_ACQUIRE);
+    return v;
+  }
+  template<class T>
+  forceinline T
+  atomic_relaxed_load(const T& x) {
+    T v;
+    __atomic_load(&x,&v,__ATOMIC_RELAXED);
+    return v;
+  }
+  template<class T>
+  forceinline void
+  atomic_store(T& x, T v) {
+    __atomic_store(&x,&v,__ATOMIC_RELEASE);
+  }
+  template<class T>
+  forceinline void
+  atomic_relaxed_store(T& x, T v) {
+    __atomic_store(&x,&v,__ATOMIC_RELAXED);
+  }
+  template<class T>
+  forceinline bool
+  atomic_cas(T& x, T& e, T d) {
+    return __atomic_compare_exchange(&x,&e,&d,false,
+                                     __ATOMIC_SEQ_CST,__ATOMIC_SEQ_CST);
+  }
+  template<class T>
+  forceinline T
+  atomic_add(T& x, T d) {
+    return __atomic_add_fetch(&x,d,__ATOMIC_SEQ_CST);
+  }
+  template<class T>
+  forceinline T
+  atomic_sub(T& x, T d) {
+    return __atomic_sub_fetch(&x,d,__ATOMIC_SEQ_CST);
+  }
+  template<class T>
+  forceinline void
+  atomic_relaxed_add(T& x, T d) {
+    (void) __atomic_fetch_add(&x,d,__ATOMIC_RELAXED);
+  }
+  forceinline double
+  atomic_add(double& x, double d) {
+    double o = atomic_relaxed_load(x);
+    double n;
+    do {
+      n = o + d;
+    } while (!__atomic_compare_exchange(&x,&o,&n,true,
+                                        __ATOMIC_RELAXED,__ATOMIC_RELAXED));
+    return n;
+  }
+  forceinline void
+  atomic_fence(void) {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  }
+
+#else
+
+  template<class T>
+  forceinline T
+  atomic_load(const T& x) {
+    atomic_mutex().acquire();
+    T v = x;
+    atomic_mutex().release();
+    return v;
+  }
+  template<class T>
+  forceinline T
+  atomic_relaxed_load(const T& x) {
+    return atomic_load(x);
+  }
+  template<class T>
+  forceinline void
+  atomic_store(T& x, T v) {
+    atomic_mutex().acquire();
+    x = v;
+    atomic_mutex().release();
+  }
+  template<class T>
+  forceinline void
+  atomic_relaxed_store(T& x, T v) {
+    atomic_store(x,v);
+  }
+  template<class T>
+  forceinline bool
+  atomic_cas(T& x, T& e, T d) {
+    bool s;
+    atomic_mutex().acquire();
+    if (x == e) {
+      x = d; s = true;
+    } else {
+      e = x; s = false;
+    }
+    atomic_mutex().release();
+    return s;
+  }
+  template<class T>
+  forceinline T
+  atomic_add(T& x, T d) {
+    atomic_mutex().acquire();
+    T v = (x += d);
+    atomic_mutex().release();
+    return v;
+  }
+  template<class T>
+  forceinline T
+  atomic_sub(T& x, T d) {
+    atomic_mutex().acquire();
+    T v = (x -= d);
+    atomic_mutex().release();
+    return v;
+  }
+  template<class T>
+  forceinline void
+  atomic_relaxed_add(T& x, T d) {
+    (void) atomic_add(x,d);
+  }
+#ifdef _MSC_VER
+  forceinline unsigned int
+  atomic_add(unsigned int& x, unsigned int d) {
+    return static_cast<unsigned int>
+      (_InterlockedExchangeAdd(reinterpret_cast<volatile long*>(&x),
+                               static_cast<long>(d))) + d;
+  }
+  forceinline unsigned int
+  atomic_sub(unsigned int& x, unsigned int d) {
+    return static_cast<unsigned int>
+      (_InterlockedExchangeAdd(reinterpret_cast<volatile long*>(&x),
+                               -static_cast<long>(d))) - d;
+  }
+#endif
+  forceinline double
+  atomic_add(double& x, double d) {
+    atomic_mutex().acquire();
+    double v = (x += d);
+    atomic_mutex().release();
+    return v;
+  }
+  forceinline void
+  atomic_fence(void) {
+    atomic_mutex().acquire();
+    atomic_mutex().release();
+  }
+
+#endif
+
+}}
+
+// STATISTICS: support-any
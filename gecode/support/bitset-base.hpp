@@ -74,10 +74,10 @@ namespace Gecode { namespace Support {
 #endif
     /// The bits
     Base bits;
+  public:
     /// Bits per base
     static const unsigned int bpb =
       static_cast<unsigned int>(CHAR_BIT * sizeof(Base));
-  public:
     /// Initialize with all bits set if \a setbits
     void init(bool setbits=false);
     /// Get number of data elements for \a s bits
@@ -112,6 +112,8 @@ namespace Gecode { namespace Support {
     void o(BitSetData a, unsigned int i);
     /// Return "or" of \a a and \a b
     static BitSetData o(BitSetData a, BitSetData b);
+    /// Perform "and" with the complement of \a a
+    void n(BitSetData a);
   };
 
   /// Status of a bitset
@@ -328,6 +330,10 @@ namespace Gecode { namespace Support {
     ab.bits = a.bits | b.bits;
     return ab;
   }
+  forceinline void
+  BitSetData::n(BitSetData a) {
+    bits &= ~a.bits;
+  }
 
 
   /*
@@ -100,4 +100,24 @@
 
 #endif
 
+/**
+ * \def GECODE_THREAD_LOCAL
+ * \brief Storage class for thread-local variables
+ *
+ * Only defined if supported by the compiler. Thread-local variables
+ * must be of a type that does not require construction or
+ * destruction (for example, a pointer).
+ *
+ */
+
+#if defined(_MSC_VER)
+
+#define GECODE_THREAD_LOCAL __declspec(thread)
+
+#elif defined(__GNUC__)
+
+#define GECODE_THREAD_LOCAL __thread
+
+#endif
+
 // STATISTICS: support-any
@@ -262,7 +262,7 @@ namespace Gecode { namespace Support {
   public:
     /// Initialize, \a d defines whether object is deleted when terminated
     Runnable(bool d=true);
-    /// Set whether to delete upon termination
+    /// Set whether to delete upon termination (only before running)
     void todelete(bool d);
     /// Return whether to be deleted upon termination
     bool todelete(void) const;
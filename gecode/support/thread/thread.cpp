@@ -50,6 +50,13 @@ namespace Gecode { namespace Support {
 
   Thread::Run* Thread::idle = NULL;
 
+#ifndef GECODE_HAS_ATOMICS
+  FastMutex& atomic_mutex(void) {
+    static FastMutex* m = new FastMutex;
+    return *m;
+  }
+#endif
+
   void
   Thread::Run::exec(void) {
     while (true) {
@@ -60,9 +67,17 @@ namespace Gecode { namespace Support {
         e=r; r=NULL;
         m.release();
         assert(e != NULL);
-        e->run();
-        if (e->todelete())
+        /*
+         * The runnable must not be accessed after it has been run
+         * unless it is deleted here: its owner might have deleted it
+         * in the meantime.
+         */
+        if (e->todelete()) {
+          e->run();
           delete e;
+        } else {
+          e->run();
+        }
       }
       // Put into idle stack
       Thread::m()->acquire();
@@ -43,6 +43,20 @@
 #include <ctime>
 #endif
 
+#ifdef GECODE_PROPAGATION_PROFILER
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+/// Whether the time-stamp counter can be read
+#define GECODE_HAS_RDTSC
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#include <x86intrin.h>
+/// Whether the time-stamp counter can be read
+#define GECODE_HAS_RDTSC
+#else
+#include <ctime>
+#endif
+#endif
+
 namespace Gecode { namespace Support {
 
   /** \brief %Timer
@@ -98,6 +112,29 @@ namespace Gecode { namespace Support {
 #endif
   }
 
+#ifdef GECODE_PROPAGATION_PROFILER
+
+  /**
+   * \brief Return a best-effort count of processor cycles
+   *
+   * Reads the time-stamp counter if available and otherwise returns
+   * the processor time used in clock ticks. Only differences between
+   * two calls by the same thread are meaningful. Only available if
+   * Gecode is configured with the propagation profiler.
+   *
+   * \ingroup FuncSupport
+   */
+  forceinline unsigned long long int
+  cycles(void) {
+#ifdef GECODE_HAS_RDTSC
+    return static_cast<unsigned long long int>(__rdtsc());
+#else
+    return static_cast<unsigned long long int>(clock());
+#endif
+  }
+
+#endif
+
 }}
 
 // STATISTICS: support-any
@@ -97,7 +97,7 @@ namespace Test {
       s[0] = new TestSpace;
 
       for (int o=n_ops; o--; )
-        switch (rand(3)) {
+        switch (rand(4)) {
         case 0:
           // clone space
           {
@@ -126,6 +126,10 @@ namespace Test {
           // post propagator
           s[space(s)]->post();
           break;
+        case 3:
+          // change decay factor
+          s[space(s)]->afc_decay((rand(2) == 0) ? 1.0 : 0.95);
+          break;
         default:
           GECODE_NEVER;
         }
@@ -272,6 +272,54 @@ namespace Test {
     }
   } sharedArrayIteratorTest;
 
+  /// %Class for testing copy-on-write arrays
+  class CowArray : public Test::Base {
+  protected:
+    /// Maximum array size
+    static const int n = 300;
+    /// Number of copies
+    static const int m = 4;
+    /// Array type being tested (with small pages)
+    typedef Gecode::CowArray<int,2> Array;
+  public:
+    /// Initialize test
+    CowArray(void) : Test::Base("Array::CowArray") {}
+    /// Perform actual tests
+    bool run(void) {
+      using namespace Gecode;
+      int s = rand(n);
+      // Spaces, arrays, and expected values for all copies
+      TestSpace h[m];
+      Array a[m];
+      int v[m][n];
+      a[0].init(h[0],s,1);
+      for (int i=0; i<s; i++)
+        v[0][i] = 1;
+      for (int k=1; k<m; k++) {
+        // Copy from random earlier array and modify some elements
+        int o = rand(k);
+        a[k].update(h[k],false,a[o]);
+        for (int i=0; i<s; i++)
+          v[k][i] = v[o][i];
+        for (int j=rand(s+1); j--; ) {
+          int i = rand(s);
+          a[k].write(i) = v[k][i] = static_cast<int>(rand(1000));
+        }
+      }
+      bool ok = true;
+      for (int k=0; k<m; k++) {
+        if (a[k].size() != s)
+          ok = false;
+        for (int i=0; i<s; i++)
+          if (a[k][i] != v[k][i])
+            ok = false;
+      }
+      for (int k=m; k--; )
+        a[k].dispose(h[k]);
+      return ok;
+    }
+  } cowArrayTest;
+
 }}
 
 // STATISTICS: test-core
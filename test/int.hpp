@@ -222,6 +222,8 @@ namespace Test { namespace Int {
     if (ipl & IPL_MEMORY) s << "+M";
     if (ipl & IPL_BASIC) s << "+B";
     if (ipl & IPL_ADVANCED) s << "+A";
+    if (ipl & IPL_TTEF) s << "+T";
+    if (ipl & IPL_ENERGETIC) s << "+E";
     return s.str();
   }
 
@@ -577,6 +577,26 @@ namespace Test { namespace Int {
             }
           }
         }
+
+        IntPropLevel ipls[] = {IPL_TTEF, IPL_ENERGETIC};
+        for (int i=0; i<2; i++) {
+          for (int c=-4; c<5; c++) {
+            int off = 0;
+            for (int coff=0; coff<2; coff++) {
+              (void) new ManFixPCumulative(c,p2,u3,off,ipls[i]);
+              (void) new ManFixPCumulative(c,p3,u3,off,ipls[i]);
+              (void) new ManFixPCumulative(c,p3,u4,off,ipls[i]);
+              (void) new ManFixPCumulative(c,p4,u4,off,ipls[i]);
+              (void) new ManFlexCumulative(c,0,2,u3,off,ipls[i]);
+              (void) new ManFlexCumulative(c,3,5,u4,off,ipls[i]);
+              (void) new OptFixPCumulative(c,p3,u3,off,ipls[i]);
+              (void) new OptFixPCumulative(c,p4,u4,off,ipls[i]);
+              (void) new OptFlexCumulative(c,0,2,u3,off,ipls[i]);
+              (void) new OptFlexCumulative(c,3,5,u4,off,ipls[i]);
+              off = Gecode::Int::Limits::min;
+            }
+          }
+        }
       }
     };
 
@@ -548,6 +548,17 @@ namespace Test { namespace Int {
          (void) new IntIntVar("C",ic3,-8,8);
          (void) new IntIntVar("D",ic4,-8,8);
 
+         // Test arrays that use a shared index
+         {
+           IntArgs ic6(SCHAR_MAX+2);
+           IntArgs bc4(SCHAR_MAX+2);
+           for (int i=0; i<ic6.size(); i++) {
+             ic6[i] = ((5*i) % 7) - 3; bc4[i] = ((i % 3) == 1) ? 1 : 0;
+           }
+           (void) new IntIntVar("E",ic6,-8,8);
+           (void) new IntBoolVar("D",bc4);
+         }
+
          // Test optimizations
          {
            int ov[] = {
@@ -516,6 +516,261 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test with tuple set and shared variables
+     class TupleSetShared : public Test {
+     public:
+       /// Create and register test
+       TupleSetShared(Gecode::IntPropLevel ipl0)
+         : Test("Extensional::TupleSet::Shared::"+str(ipl0),
+                3,0,2,false,ipl0) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         return (2*x[0] + x[1] + x[2]) % 3 == 0;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         TupleSet t;
+         for (int a=0; a<3; a++)
+           for (int b=0; b<3; b++)
+             for (int c=0; c<3; c++)
+               for (int d=0; d<3; d++)
+                 if ((a+b+c+d) % 3 == 0) {
+                   IntArgs tuple(4, a, b, c, d);
+                   t.add(tuple);
+                 }
+         t.finalize();
+         IntVarArgs y(4);
+         y[0]=x[0]; y[1]=x[1]; y[2]=x[2]; y[3]=x[0];
+         extensional(home, y, t, ipl);
+       }
+     };
+
+
+     /// %Test with tuple set with ranges and wildcards
+     class TupleSetRanges : public Test {
+     public:
+       /// Create and register test
+       TupleSetRanges(Gecode::IntPropLevel ipl0)
+         : Test("Extensional::TupleSet::Ranges::"+str(ipl0),
+                4,-1,4,false,ipl0) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         // Wildcards also match values not in the tuple set
+         return ((x[0] == 0 && x[2] == 2) ||
+                 (x[0] >= 1 && x[0] <= 2 && x[1] >= 1 && x[1] <= 3 &&
+                  x[2] >= 0 && x[2] <= 1 && x[3] >= 3) ||
+                 (x[0] == 3 && x[2] == 3 && x[3] >= 0 && x[3] <= 1) ||
+                 (x[0] == 4 && x[1] == 4 && x[2] == 4 && x[3] == 4));
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         TupleSet t;
+         t.add(IntArgs(4, 0, TupleSet::any, 2, TupleSet::any));
+         t.add(IntArgs(4, 1, 1, 0, 3), IntArgs(4, 2, 3, 1, 4));
+         t.add(IntArgs(4, 4, 4, 4, 4));
+         t.add(IntArgs(4, 3, TupleSet::any, 3, 0),
+               IntArgs(4, 3, 0, 3, 1));
+         t.add(IntArgs(4, 1, 2, 3, 4), IntArgs(4, 1, 2, 2, 4));
+         t.finalize();
+         extensional(home, x, t, ipl);
+       }
+     };
+
+     /// %Test with tuple set where wildcards match values not in the set
+     class TupleSetWildcards : public Test {
+     protected:
+       /// Whether the tuple set only has a tuple of wildcards
+       bool all;
+     public:
+       /// Create and register test
+       TupleSetWildcards(bool a, Gecode::IntPropLevel ipl0)
+         : Test("Extensional::TupleSet::Wildcards::"+
+                std::string(a ? "All::" : "Some::")+str(ipl0),
+                3,-2,2,false,ipl0), all(a) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         if (all)
+           return true;
+         return ((x[0] == 0 && x[2] == 1) ||
+                 (x[0] == 1 && x[1] == 0 && x[2] == 0) ||
+                 (x[1] == 1 && x[2] >= 0 && x[2] <= 1));
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         TupleSet t;
+         if (all) {
+           t.add(IntArgs(3, TupleSet::any, TupleSet::any, TupleSet::any));
+         } else {
+           t.add(IntArgs(3, 0, TupleSet::any, 1));
+           t.add(IntArgs(3, 1, 0, 0));
+           t.add(IntArgs(3, TupleSet::any, 1, 0),
+                 IntArgs(3, 0, 1, 1));
+         }
+         t.finalize();
+         extensional(home, x, t, ipl);
+       }
+     };
+
+     /// %Test for many constraints sharing a tuple set with wildcards
+     class TupleSetWide : public Base {
+     protected:
+       /// Space with extensional constraints
+       class TestSpace : public Gecode::Space {
+       public:
+         /// The variables
+         Gecode::IntVarArray x;
+         /// Constructor for creation for tuple set \a t
+         TestSpace(const Gecode::TupleSet& t)
+           : x(*this,3*n_posts,-1000000000,1000000000) {
+           for (int i=0; i<n_posts; i++)
+             extensional(*this,x.slice(3*i,1,3),t);
+         }
+         /// Constructor for cloning \a s
+         TestSpace(bool share, TestSpace& s) : Space(share,s) {
+           x.update(*this,share,s.x);
+         }
+         /// Copy during cloning
+         virtual Space* copy(bool share) {
+           return new TestSpace(share,*this);
+         }
+       };
+       /// Number of posted constraints
+       static const int n_posts = 1024;
+     public:
+       /// Create and register test
+       TupleSetWide(void) : Base("Int::Extensional::TupleSet::Wide") {}
+       /// Perform test
+       virtual bool run(void) {
+         using namespace Gecode;
+         TupleSet t;
+         t.add(IntArgs(3, 0, TupleSet::any, 1));
+         t.add(IntArgs(3, 1, 0, 0));
+         t.add(IntArgs(3, TupleSet::any, 1, 0),
+               IntArgs(3, 0, 1, 1));
+         t.finalize();
+         TestSpace* s = new TestSpace(t);
+         bool ok = (s->status() != SS_FAILED);
+         // Wildcards keep all values, the last position has none
+         for (int i=0; ok && (i<n_posts); i++)
+           ok = (s->x[3*i].min() == -1000000000) &&
+             (s->x[3*i].max() == 1000000000) &&
+             (s->x[3*i+1].min() == -1000000000) &&
+             (s->x[3*i+1].max() == 1000000000) &&
+             (s->x[3*i+2].min() == 0) && (s->x[3*i+2].max() == 1);
+         // Values outside of the tuple set only match wildcards
+         for (int i=0; ok && (i<n_posts); i++) {
+           rel(*s, s->x[3*i+(i & 1)], IRT_EQ, 1000000000-i);
+           ok = (s->status() != SS_FAILED);
+           if (i & 1)
+             ok = ok && s->x[3*i].assigned() && (s->x[3*i].val() == 0) &&
+               s->x[3*i+2].assigned() && (s->x[3*i+2].val() == 1);
+           else
+             ok = ok && s->x[3*i+1].assigned() && (s->x[3*i+1].val() == 1) &&
+               (s->x[3*i+2].min() == 0) && (s->x[3*i+2].max() == 1);
+         }
+         if (ok) {
+           TestSpace* c = static_cast<TestSpace*>(s->clone());
+           rel(*c, c->x[3*(n_posts-1)+2], IRT_EQ, 0);
+           ok = (c->status() == SS_FAILED);
+           delete c;
+         }
+         delete s;
+         return ok;
+       }
+     };
+
+#ifdef GECODE_HAS_THREADS
+
+     /// %Test for tuple sets shared by spaces in different threads
+     class TupleSetThreads : public Base {
+     protected:
+       /// Space with extensional constraint
+       class TestSpace : public Gecode::Space {
+       public:
+         /// The variables
+         Gecode::IntVarArray x;
+         /// Constructor for creation for tuple set \a t
+         TestSpace(const Gecode::TupleSet& t) : x(*this,3,0,2) {
+           extensional(*this,x,t);
+         }
+         /// Constructor for cloning \a s
+         TestSpace(bool share, TestSpace& s) : Space(share,s) {
+           x.update(*this,share,s.x);
+         }
+         /// Copy during cloning
+         virtual Space* copy(bool share) {
+           return new TestSpace(share,*this);
+         }
+       };
+       /// Clone and delete spaces repeatedly
+       class Cloner : public Gecode::Support::Runnable {
+       public:
+         /// The current space
+         TestSpace* s;
+         /// Signalled when done
+         Gecode::Support::Event e;
+         /// Whether the spaces are still correct
+         bool ok;
+         /// Initialize with space \a s0
+         Cloner(TestSpace* s0)
+           : Gecode::Support::Runnable(false), s(s0), ok(false) {}
+         /// Clone the space without sharing
+         virtual void run(void) {
+           for (int i=0; i<n_clones; i++) {
+             TestSpace* c = static_cast<TestSpace*>(s->clone(false));
+             delete s; s = c;
+           }
+           Gecode::rel(*s, s->x[0], Gecode::IRT_EQ, 1);
+           Gecode::rel(*s, s->x[1], Gecode::IRT_EQ, 1);
+           ok = (s->status() != Gecode::SS_FAILED) && s->x[2].assigned() &&
+             (s->x[2].val() == 1);
+           delete s;
+           e.signal();
+         }
+       };
+       /// Number of threads
+       static const int n_threads = 4;
+       /// Number of clones per thread
+       static const int n_clones = 1024;
+     public:
+       /// Create and register test
+       TupleSetThreads(void) : Base("Int::Extensional::TupleSet::Threads") {}
+       /// Perform test
+       virtual bool run(void) {
+         using namespace Gecode;
+         TestSpace* r;
+         {
+           // The tuple set is only kept alive by the spaces
+           TupleSet t;
+           for (int a=0; a<3; a++)
+             for (int b=0; b<3; b++)
+               for (int c=0; c<3; c++)
+                 if ((a+b+c) % 3 == 0)
+                   t.add(IntArgs(3, a, b, c));
+           t.finalize();
+           r = new TestSpace(t);
+         }
+         (void) r->status();
+         Cloner* c[n_threads];
+         for (int i=0; i<n_threads; i++)
+           c[i] = new Cloner(static_cast<TestSpace*>(r->clone(false)));
+         for (int i=0; i<n_threads; i++)
+           Support::Thread::run(c[i]);
+         bool ok = true;
+         for (int i=0; i<n_threads; i++) {
+           c[i]->e.wait();
+           ok = ok && c[i]->ok;
+           delete c[i];
+         }
+         delete r;
+         return ok;
+       }
+     };
+
+#endif
 
      RegSimpleA ra;
      RegSimpleB rb;
@@ -547,12 +802,30 @@ namespace Test { namespace Int {
 
      TupleSetA tsam(Gecode::IPL_MEMORY);
      TupleSetA tsas(Gecode::IPL_SPEED);
+     TupleSetA tsab(Gecode::IPL_BASIC);
 
      TupleSetB tsbm(Gecode::IPL_MEMORY);
      TupleSetB tsbs(Gecode::IPL_SPEED);
+     TupleSetB tsbb(Gecode::IPL_BASIC);
 
      TupleSetBool tsboolm(Gecode::IPL_MEMORY, 0.3);
      TupleSetBool tsbools(Gecode::IPL_SPEED, 0.3);
+     TupleSetBool tsboolb(Gecode::IPL_BASIC, 0.3);
+
+     TupleSetShared tsss(Gecode::IPL_SPEED);
+
+     TupleSetRanges tsrm(Gecode::IPL_MEMORY);
+     TupleSetRanges tsrs(Gecode::IPL_SPEED);
+
+     TupleSetWildcards tswas(true,Gecode::IPL_SPEED);
+     TupleSetWildcards tswss(false,Gecode::IPL_SPEED);
+     TupleSetWildcards tswsm(false,Gecode::IPL_MEMORY);
+
+     TupleSetWide tsw;
+
+#ifdef GECODE_HAS_THREADS
+     TupleSetThreads tst;
+#endif
      //@}
 
    }
@@ -152,6 +152,37 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test linear relation with many terms over integer variables
+     class IntIntLarge : public IntInt {
+     public:
+       /// Create and register test
+       IntIntLarge(const std::string& s, const Gecode::IntSet& d,
+                   const Gecode::IntArgs& a0, Gecode::IntRelType irt0,
+                   int c0)
+         : IntInt(s,d,a0,irt0,c0) {
+         testsearch = false;
+       }
+       /// Create random assignment
+       virtual Assignment* assignment(void) const {
+         return new RandomAssignment(arity,dom,200);
+       }
+     };
+
+     /// %Test linear relation with many terms over integer variables
+     class IntVarLarge : public IntVar {
+     public:
+       /// Create and register test
+       IntVarLarge(const std::string& s, const Gecode::IntSet& d,
+                   const Gecode::IntArgs& a0, Gecode::IntRelType irt0)
+         : IntVar(s,d,a0,irt0) {
+         testsearch = false;
+       }
+       /// Create random assignment
+       virtual Assignment* assignment(void) const {
+         return new RandomAssignment(arity,dom,200);
+       }
+     };
+
      /// %Test linear relation over Boolean variables equal to constant
      class BoolInt : public Test {
      protected:
@@ -261,6 +292,151 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test bounds consistency of linear relations with many terms
+     class IntIncBounds : public Base {
+     protected:
+       /// Space for the linear relation
+       class TestSpace : public Gecode::Space {
+       public:
+         /// The variables
+         Gecode::IntVarArray x;
+         /// Constructor for creation
+         TestSpace(const Gecode::IntArgs& l, const Gecode::IntArgs& u)
+           : x(*this,l.size()) {
+           for (int i=0; i<x.size(); i++)
+             x[i] = Gecode::IntVar(*this,l[i],u[i]);
+         }
+         /// Constructor for cloning \a s
+         TestSpace(bool share, TestSpace& s) : Space(share,s) {
+           x.update(*this,share,s.x);
+         }
+         /// Copy during cloning
+         virtual Space* copy(bool share) {
+           return new TestSpace(share,*this);
+         }
+       };
+       /// Number of terms
+       int n;
+       /// Bound on the absolute value of the coefficients
+       int m;
+       /// Bound on the absolute value of the variables
+       int b;
+       /// Integer relation type to propagate
+       Gecode::IntRelType irt;
+       /// Return \a a divided by \a d rounded down
+       static long long int fdiv(long long int a, long long int d) {
+         long long int q = a / d;
+         return ((a % d != 0) && ((a < 0) != (d < 0))) ? q-1 : q;
+       }
+       /// Return \a a divided by \a d rounded up
+       static long long int cdiv(long long int a, long long int d) {
+         return -fdiv(-a,d);
+       }
+       /// Tighten \a l and \a u to bounds consistency, return false if failed
+       bool bounds(const Gecode::IntArgs& a, long long int c,
+                   long long int* l, long long int* u) const {
+         using namespace Gecode;
+         bool lq = (irt == IRT_EQ) || (irt == IRT_LQ);
+         bool gq = (irt == IRT_EQ) || (irt == IRT_GQ);
+         bool modified;
+         do {
+           modified = false;
+           long long int smin = 0, smax = 0;
+           for (int i=0; i<n; i++) {
+             smin += std::min(a[i]*l[i],a[i]*u[i]);
+             smax += std::max(a[i]*l[i],a[i]*u[i]);
+           }
+           for (int i=0; i<n; i++) {
+             long long int rmin = smin - std::min(a[i]*l[i],a[i]*u[i]);
+             long long int rmax = smax - std::max(a[i]*l[i],a[i]*u[i]);
+             long long int li = l[i], ui = u[i];
+             if (lq) {
+               // a[i]*x[i] <= c-rmin
+               if (a[i] > 0)
+                 ui = std::min(ui,fdiv(c-rmin,a[i]));
+               else
+                 li = std::max(li,cdiv(c-rmin,a[i]));
+             }
+             if (gq) {
+               // a[i]*x[i] >= c-rmax
+               if (a[i] > 0)
+                 li = std::max(li,cdiv(c-rmax,a[i]));
+               else
+                 ui = std::min(ui,fdiv(c-rmax,a[i]));
+             }
+             if (li > ui)
+               return false;
+             if ((li != l[i]) || (ui != u[i])) {
+               l[i] = li; u[i] = ui; modified = true;
+             }
+           }
+         } while (modified);
+         return true;
+       }
+     public:
+       /// Create and register test
+       IntIncBounds(int n0, int m0, int b0, Gecode::IntRelType irt0)
+         : Base("Int::Linear::Int::Inc::Bounds::"+Test::str(irt0)+"::"+
+                Test::str(n0)+"::"+Test::str(m0)+"::"+Test::str(b0)),
+           n(n0), m(m0), b(b0), irt(irt0) {}
+       /// Perform test
+       virtual bool run(void) {
+         using namespace Gecode;
+         // Coefficients with mixed signs, the first one for a gcd of one
+         IntArgs a(n), xl(n), xu(n);
+         for (int i=0; i<n; i++) {
+           a[i] = (i == 0) ? 1 : static_cast<int>(rand(m))+1;
+           if (rand(2) != 0)
+             a[i] = -a[i];
+           // Domains contain negative and positive values
+           xl[i] = -static_cast<int>(rand(b))-1;
+           xu[i] = static_cast<int>(rand(b))+1;
+         }
+         long long int c = static_cast<long long int>(rand(2*b)) - b;
+         TestSpace* s = new TestSpace(xl,xu);
+         linear(*s, a, s->x, irt, static_cast<int>(c));
+         long long int* l = new long long int[n];
+         long long int* u = new long long int[n];
+         for (int i=0; i<n; i++) {
+           l[i] = xl[i]; u[i] = xu[i];
+         }
+         bool ok = true;
+         for (int k=0; ok && (k<4*n); k++) {
+           bool failed = !bounds(a,c,l,u);
+           if (s->status() == SS_FAILED) {
+             ok = failed;
+             break;
+           }
+           if (failed) {
+             ok = false;
+             break;
+           }
+           bool assigned = true;
+           for (int i=0; i<n; i++) {
+             ok = ok && (s->x[i].min() == l[i]) && (s->x[i].max() == u[i]);
+             assigned = assigned && (l[i] == u[i]);
+           }
+           if (assigned)
+             break;
+           // Tighten a bound of a random variable that is not assigned
+           int i;
+           do {
+             i = static_cast<int>(rand(n));
+           } while (l[i] == u[i]);
+           int v = static_cast<int>(l[i]) +
+             static_cast<int>(rand(static_cast<unsigned int>(u[i]-l[i])));
+           if (rand(2) != 0) {
+             rel(*s, s->x[i], IRT_LQ, v); u[i] = v;
+           } else {
+             rel(*s, s->x[i], IRT_GQ, v+1); l[i] = v+1;
+           }
+         }
+         delete [] l; delete [] u;
+         delete s;
+         return ok;
+       }
+     };
+
      /// Help class to create and register tests
      class Create {
      public:
@@ -336,6 +512,28 @@ namespace Test { namespace Int {
              }
            }
          }
+         {
+           // Linear relations with many terms
+           IntSet d(0,1);
+           IntArgs a1(64), a2(64);
+           for (int i=0; i<64; i++) {
+             a1[i] = 1; a2[i] = (i & 1) ? -(i % 5 + 1) : i % 5 + 1;
+           }
+           for (IntRelTypes irts; irts(); ++irts) {
+             (void) new IntIntLarge("1",d,a1,irts.irt(),32);
+             (void) new IntIntLarge("2",d,a2,irts.irt(),0);
+             (void) new IntVarLarge("1",d,a1,irts.irt());
+             (void) new IntVarLarge("2",d,a2,irts.irt());
+           }
+           // Wide domains with negative and positive values
+           IntRelType irt[] = {IRT_EQ, IRT_LQ, IRT_GQ};
+           for (int i=0; i<3; i++) {
+             (void) new IntIncBounds(64,1,1000,irt[i]);
+             (void) new IntIncBounds(64,5,1000000,irt[i]);
+             (void) new IntIncBounds(100,1,100000000,irt[i]);
+             (void) new IntIncBounds(100,7,100000000,irt[i]);
+           }
+         }
          {
            const int av1[10] = {
              1, 1, 1, 1, 1, 1, 1, 1, 1, 1
@@ -367,6 +565,27 @@ namespace Test { namespace Int {
              }
            }
 
+           IntArgs a10(8, 3,-5,7,-2,9,1,-4,6);
+           IntArgs a11(8, 12,7,7,5,3,2,1,1);
+
+           for (IntRelTypes irts; irts(); ++irts) {
+             for (int c=-12; c<=36; c += 4) {
+               (void) new BoolInt("10",a10,irts.irt(),c);
+               (void) new BoolInt("11",a11,irts.irt(),c);
+             }
+           }
+
+           // Sums of coefficients exceeding the integer limits
+           IntArgs a12(2, 2000000000,-2000000000);
+           IntArgs a13(3, 1000000000,-2000000000,1000000000);
+
+           for (int c=-100000000; c<=100000000; c += 100000000) {
+             (void) new BoolInt("12",a12,IRT_LQ,c);
+             (void) new BoolInt("12",a12,IRT_GQ,c);
+             (void) new BoolInt("13",a13,IRT_LQ,c);
+             (void) new BoolInt("13",a13,IRT_GQ,c);
+           }
+
            for (int i=1; i<=5; i += 2) {
              IntArgs a1(i, av1);
              IntArgs a2(i, av2);
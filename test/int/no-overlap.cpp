@@ -59,9 +59,11 @@ namespace Test { namespace Int {
       Gecode::IntArgs h;
     public:
       /// Create and register test with maximal coordinate value \a m
-      Int2(int m, const Gecode::IntArgs& w0, const Gecode::IntArgs& h0)
-        : Test("NoOverlap::Int::2::"+str(m)+"::"+str(w0)+"::"+str(h0),
-               2*w0.size(), 0, m-1),
+      Int2(int m, const Gecode::IntArgs& w0, const Gecode::IntArgs& h0,
+           Gecode::IntPropLevel ipl=Gecode::IPL_DEF)
+        : Test("NoOverlap::Int::2::"+str(m)+"::"+str(w0)+"::"+str(h0)+
+               "::"+str(ipl),
+               2*w0.size(), 0, m-1, false, ipl),
           w(w0), h(h0) {
       }
       /// %Test whether \a xy is solution
@@ -86,7 +88,7 @@ namespace Test { namespace Int {
         for (int i=0; i<n; i++) {
           x[i]=xy[2*i+0]; y[i]=xy[2*i+1];
         }
-        nooverlap(home, x, w, y, h);
+        nooverlap(home, x, w, y, h, ipl);
       }
     };
     /// %Test for no-overlap with optional rectangles
@@ -98,9 +100,11 @@ namespace Test { namespace Int {
       Gecode::IntArgs h;
     public:
       /// Create and register test with maximal value \a m and \a n rectangles
-      IntOpt2(int m, const Gecode::IntArgs& w0, const Gecode::IntArgs& h0)
-        : Test("NoOverlap::Int::Opt::2::"+str(m)+"::"+str(w0)+"::"+str(h0),
-               3*w0.size(), 0, m-1), w(w0), h(h0) {}
+      IntOpt2(int m, const Gecode::IntArgs& w0, const Gecode::IntArgs& h0,
+              Gecode::IntPropLevel ipl=Gecode::IPL_DEF)
+        : Test("NoOverlap::Int::Opt::2::"+str(m)+"::"+str(w0)+"::"+str(h0)+
+               "::"+str(ipl),
+               3*w0.size(), 0, m-1, false, ipl), w(w0), h(h0) {}
       /// %Test whether \a xyo is solution
       virtual bool solution(const Assignment& xyo) const {
         int n = xyo.size() / 3;
@@ -128,7 +132,7 @@ namespace Test { namespace Int {
           x[i]=xyo[3*i+0]; y[i]=xyo[3*i+1];
           o[i]=expr(home, xyo[3*i+2] > 0);
         }
-        nooverlap(home, x, w, y, h, o);
+        nooverlap(home, x, w, y, h, o, ipl);
       }
     };
 
@@ -282,6 +286,22 @@ namespace Test { namespace Int {
           (void) new IntOpt2(m, s4, s3);
         }
 
+        IntArgs s5(5, 3,2,2,1,1);
+        IntArgs s6(5, 2,1,3,1,2);
+        IntArgs s7(3, 2,2,3);
+
+        for (int m=2; m<4; m++) {
+          (void) new Int2(m, s1, s1, IPL_BND);
+          (void) new Int2(m, s2, s3, IPL_BND);
+          (void) new Int2(m, s4, s4, IPL_BND);
+          (void) new Int2(m, s4, s2, IPL_BND);
+          (void) new IntOpt2(m, s2, s3, IPL_BND);
+          (void) new IntOpt2(m, s4, s3, IPL_BND);
+        }
+        (void) new Int2(3, s5, s6, IPL_BND);
+        (void) new Int2(5, s7, s7, IPL_BND);
+        (void) new IntOpt2(3, s7, s7, IPL_BND);
+
         (void) new Var2(2, 2);
         (void) new Var2(3, 2);
         (void) new Var2(1, 3);
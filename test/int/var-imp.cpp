@@ -0,0 +1,183 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test/int.hh"
+
+namespace Test { namespace Int {
+
+  /// %Tests for integer variable implementations
+  namespace VarImp {
+
+    /**
+     * \defgroup TaskTestIntVarImp Integer variable implementations
+     * \ingroup TaskTestInt
+     */
+    //@{
+    /// Test space
+    class TestSpace : public Gecode::Space {
+    public:
+      /// The variable
+      Gecode::IntVar x;
+      /// Constructor for creation
+      TestSpace(const Gecode::IntSet& d) : x(*this,d) {}
+      /// Constructor for cloning \a s
+      TestSpace(bool share, TestSpace& s) : Space(share,s) {
+        x.update(*this,share,s.x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(bool share) {
+        return new TestSpace(share,*this);
+      }
+    };
+
+    /// %Test for dense domains with holes (bitset representation)
+    class Bits : public Base {
+    protected:
+      /// Minimal value of the domain
+      int l;
+      /// Width of the domain
+      int w;
+      /// How many values to remove
+      static const int n_remove = 24;
+      /// Check that the domain of \a s is the set \a d (relative to \a l)
+      bool same(TestSpace& s, const std::vector<bool>& d) {
+        using namespace Gecode;
+        unsigned int n = 0;
+        int mi = Gecode::Int::Limits::max, ma = Gecode::Int::Limits::min;
+        for (int i=0; i<w; i++)
+          if (d[i]) {
+            n++; mi = std::min(mi,l+i); ma = std::max(ma,l+i);
+          }
+        if ((s.x.size() != n) || (s.x.min() != mi) || (s.x.max() != ma))
+          return false;
+        for (int i=0; i<w; i++)
+          if (s.x.in(l+i) != d[i])
+            return false;
+        // Forward iteration over ranges
+        {
+          int i = 0;
+          for (Gecode::Int::IntVarImpFwd r(s.x.varimp()); r(); ++r) {
+            while ((i < w) && !d[i])
+              i++;
+            if ((i == w) || (r.min() != l+i))
+              return false;
+            while ((i < w) && d[i])
+              i++;
+            if ((r.max() != l+i-1) ||
+                (r.width() != static_cast<unsigned int>(r.max()-r.min()+1)))
+              return false;
+          }
+          while ((i < w) && !d[i])
+            i++;
+          if (i != w)
+            return false;
+        }
+        // Backward iteration over ranges
+        {
+          int i = w-1;
+          for (Gecode::Int::IntVarImpBwd r(s.x.varimp()); r(); ++r) {
+            while ((i >= 0) && !d[i])
+              i--;
+            if ((i < 0) || (r.max() != l+i))
+              return false;
+            while ((i >= 0) && d[i])
+              i--;
+            if ((r.min() != l+i+1) ||
+                (r.width() != static_cast<unsigned int>(r.max()-r.min()+1)))
+              return false;
+          }
+          while ((i >= 0) && !d[i])
+            i--;
+          if (i != -1)
+            return false;
+        }
+        return true;
+      }
+    public:
+      /// Create and register test for minimum \a l0 and width \a w0
+      Bits(int l0, int w0)
+        : Base("Int::VarImp::Bits::"+Test::str(l0)+"::"+Test::str(w0)),
+          l(l0), w(w0) {}
+      /// Perform test
+      virtual bool run(void) {
+        using namespace Gecode;
+        // Dense domain with holes at every third value
+        std::vector<bool> d(w);
+        IntArgs v;
+        for (int i=0; i<w; i++) {
+          d[i] = (i % 3) != 1;
+          if (d[i])
+            v << (l+i);
+        }
+        TestSpace* s = new TestSpace(IntSet(v));
+        if (!same(*s,d)) {
+          delete s; return false;
+        }
+        TestSpace* c = NULL;
+        std::vector<bool> e;
+        bool ok = true;
+        for (int k=0; ok && (k<n_remove); k++) {
+          // Remove a random value, but never empty the domain
+          int i = static_cast<int>(rand(static_cast<unsigned int>(w)));
+          if (d[i] && (s->x.size() > 1)) {
+            d[i] = false;
+            Gecode::Int::IntView x(s->x);
+            ok = !me_failed(x.nq(*s,l+i)) && !s->failed();
+          }
+          ok = ok && same(*s,d);
+          // Clone halfway, the clone must not see later removals
+          if (ok && (k == n_remove / 2)) {
+            c = static_cast<TestSpace*>(s->clone());
+            e = d;
+          }
+        }
+        ok = ok && same(*c,e);
+        delete s; delete c;
+        return ok;
+      }
+    };
+
+    Bits b_0_8(0,8);
+    Bits b_m5_17(-5,17);
+    Bits b_3_33(3,33);
+    Bits b_m40_64(-40,64);
+    //@}
+
+  }
+}}
+
+// STATISTICS: test-int
@@ -0,0 +1,274 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+#include <gecode/int.hh>
+
+#include "test/test.hh"
+
+namespace Test {
+
+  /// %Tests for memory management
+  namespace Memory {
+
+    /// Test space
+    class TestSpace : public Gecode::Space {
+    public:
+      /// Integer variables
+      Gecode::IntVarArray x;
+      /// Constructor for creation with \a n variables
+      TestSpace(int n) : x(*this,n,0,n) {}
+      /// Constructor for cloning \a s
+      TestSpace(bool share, TestSpace& s) : Space(share,s) {
+        x.update(*this,share,s.x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(bool share) {
+        return new TestSpace(share,*this);
+      }
+      /// Check that variables have not been modified
+      bool ok(void) const {
+        for (int i=0; i<x.size(); i++)
+          if ((x[i].min() != 0) || (x[i].max() != x.size()))
+            return false;
+        return true;
+      }
+    };
+
+    /// Whether \a s is a power of two
+    bool pow2(size_t s) {
+      return (s > 0) && ((s & (s-1)) == 0);
+    }
+
+    /// %Test for normalizing memory policies
+    class Normalize : public Test::Base {
+    public:
+      /// Initialize test
+      Normalize(void) : Test::Base("Memory::Policy::Normalize") {}
+      /// Check normalization of heap chunk sizes \a min and \a max
+      bool check(size_t min, size_t max) {
+        using namespace Gecode;
+        MemoryPolicy mp;
+        mp.hcsz_min = min; mp.hcsz_max = max;
+        mp.normalize();
+        if (!pow2(mp.hcsz_min) || !pow2(mp.hcsz_max) ||
+            (mp.hcsz_min < MemoryConfig::hcsz_min) ||
+            (mp.hcsz_max < mp.hcsz_min) ||
+            // Rounded up, unless the size is too large
+            ((mp.hcsz_min < min) && (2*mp.hcsz_min > mp.hcsz_min)) ||
+            // Rounded down, unless smaller than the minimal size
+            ((mp.hcsz_max > max) && (mp.hcsz_max > mp.hcsz_min))) {
+          olog << ind(2) << "Normalizing (" << min << "," << max
+               << ") gives (" << mp.hcsz_min << "," << mp.hcsz_max << ")"
+               << std::endl;
+          return false;
+        }
+        return true;
+      }
+      /// Perform actual tests
+      bool run(void) {
+        using namespace Gecode;
+        {
+          MemoryPolicy mp;
+          mp.hcsz_min = 1000; mp.hcsz_max = 5000;
+          mp.normalize();
+          if ((mp.hcsz_min != 1024) || (mp.hcsz_max != 4096))
+            return false;
+          mp.hcsz_min = 3000; mp.hcsz_max = 2000;
+          mp.normalize();
+          if ((mp.hcsz_min != 4096) || (mp.hcsz_max != 4096))
+            return false;
+        }
+        const size_t m = ~static_cast<size_t>(0);
+        if (!check(0,0) || !check(m,m) || !check(0,m) || !check(m,0))
+          return false;
+        for (int i=0; i<256; i++) {
+          size_t min = static_cast<size_t>(rand(1U << 20));
+          size_t max = static_cast<size_t>(rand(1U << 20));
+          if (!check(min,max))
+            return false;
+        }
+        // Policies are normalized when set for a space
+        TestSpace* s = new TestSpace(1);
+        MemoryPolicy mp;
+        mp.hcsz_min = 3000; mp.hcsz_max = 30000;
+        s->memory(mp);
+        bool ok = ((s->memory().hcsz_min == 4096) &&
+                   (s->memory().hcsz_max == 16384));
+        delete s;
+        return ok;
+      }
+    };
+
+    /// %Test for learning chunk sizes when cloning
+    class Adaptive : public Test::Base {
+    protected:
+      /// Maximal chunk size
+      size_t max;
+    public:
+      /// Initialize test with maximal chunk size \a m
+      Adaptive(const std::string& n, size_t m)
+        : Test::Base("Memory::Policy::Adaptive::"+n), max(m) {}
+      /// Perform actual tests
+      bool run(void) {
+        using namespace Gecode;
+        TestSpace* s = new TestSpace(4096);
+        MemoryPolicy mp;
+        mp.hcsz_max = max; mp.adaptive = true;
+        s->memory(mp);
+        bool ok = true;
+        for (int i=0; ok && (i<8); i++) {
+          TestSpace* c = static_cast<TestSpace*>(s->clone(i % 2 == 0));
+          // Memory for the clone is allocated in chunks of limited size
+          for (int j=0; j<64; j++)
+            (void) c->ralloc(max / 2);
+          ok = c->ok() && (c->memory().hcsz_max == s->memory().hcsz_max);
+          delete s; s = c;
+        }
+        delete s;
+        return ok;
+      }
+    };
+
+#ifdef GECODE_HAS_THREADS
+
+    /// Allocate and free heap chunks through the pool of the current thread
+    bool pool(void) {
+      using namespace Gecode;
+      HeapChunkPool* p = HeapChunkPool::current();
+      // Thread-local pools are not supported
+      if (p == NULL)
+        return true;
+      p->flush();
+      size_t s = static_cast<size_t>(1) << MemoryConfig::hcp_sc_min;
+      HeapChunk* hc = static_cast<HeapChunk*>(heap.ralloc(s));
+      hc->size = s;
+      p->free(hc);
+      if ((p->size() != s) || (p->alloc(s) != hc) || (p->size() != 0))
+        return false;
+      heap.rfree(hc);
+      // Spaces release their chunks to the pool
+      for (int i=0; i<8; i++) {
+        TestSpace* t = new TestSpace(256);
+        TestSpace* c = static_cast<TestSpace*>(t->clone());
+        delete t;
+        if (!c->ok())
+          return false;
+        delete c;
+      }
+      return HeapChunkPool::current() == p;
+    }
+
+    /// Runnable using the pool of its thread
+    class PoolUser : public Gecode::Support::Runnable {
+    public:
+      /// Whether using the pool succeeded
+      bool ok;
+      /// The pool used
+      Gecode::HeapChunkPool* p;
+      /// Signalled when done
+      Gecode::Support::Event e;
+      /// Initialize
+      PoolUser(void) : Gecode::Support::Runnable(false), ok(false), p(NULL) {}
+      /// Use the pool
+      virtual void run(void) {
+        ok = pool(); p = Gecode::HeapChunkPool::current();
+        e.signal();
+      }
+    };
+
+#ifdef GECODE_THREADS_PTHREADS
+    /// Use the pool from a thread that exits afterwards
+    void* exiting(void* ok) {
+      *static_cast<bool*>(ok) = pool();
+      return NULL;
+    }
+#endif
+
+    /// %Test for heap chunk pools used by several threads
+    class Pool : public Test::Base {
+    public:
+      /// Initialize test
+      Pool(void) : Test::Base("Memory::Pool::Threads") {}
+      /// Perform actual tests
+      bool run(void) {
+        using namespace Gecode;
+        if (!pool())
+          return false;
+        static const int n = 4;
+        PoolUser* u[n];
+        for (int i=0; i<n; i++) {
+          u[i] = new PoolUser;
+          Support::Thread::run(u[i]);
+        }
+        bool ok = true;
+        for (int i=0; i<n; i++) {
+          u[i]->e.wait();
+          // Different threads use different pools
+          ok = ok && u[i]->ok &&
+            ((u[i]->p == NULL) || (u[i]->p != HeapChunkPool::current()));
+          delete u[i];
+        }
+#ifdef GECODE_THREADS_PTHREADS
+        // The pools of exiting threads are deleted
+        for (int i=0; ok && (i<n); i++) {
+          pthread_t t;
+          bool t_ok = false;
+          if (pthread_create(&t, NULL, exiting, &t_ok) != 0)
+            return false;
+          (void) pthread_join(t, NULL);
+          ok = t_ok;
+        }
+#endif
+        return ok;
+      }
+    };
+
+    Pool p;
+
+#endif
+
+    Normalize normalize;
+    Adaptive adaptive_1("1K",1024);
+    Adaptive adaptive_8("8K",8 * 1024);
+    Adaptive adaptive_256("256K",256 * 1024);
+
+  }
+
+}
+
+// STATISTICS: test-core
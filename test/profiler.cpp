@@ -0,0 +1,192 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+#include <gecode/int.hh>
+
+#include "test/test.hh"
+
+#ifdef GECODE_PROPAGATION_PROFILER
+
+#include <sstream>
+
+namespace Test {
+
+  /// %Test for propagation profiler
+  class Profiler : public Test::Base {
+  protected:
+    /**
+     * \brief Propagator with known behaviour
+     *
+     * If the minimum of the view is zero, it is pruned and the
+     * propagator reports no fixpoint. If the view is assigned to 9,
+     * the propagator fails, if it is assigned otherwise, the
+     * propagator is subsumed.
+     */
+    class P : public Gecode::UnaryPropagator<Gecode::Int::IntView,
+                                             Gecode::Int::PC_INT_BND> {
+    protected:
+      using Gecode::UnaryPropagator<Gecode::Int::IntView,
+                                    Gecode::Int::PC_INT_BND>::x0;
+    public:
+      /// Constructor for posting
+      P(Gecode::Home home, Gecode::Int::IntView x)
+        : Gecode::UnaryPropagator<Gecode::Int::IntView,
+                                  Gecode::Int::PC_INT_BND>(home,x) {}
+      /// Constructor for cloning \a p
+      P(Gecode::Space& home, bool share, P& p)
+        : Gecode::UnaryPropagator<Gecode::Int::IntView,
+                                  Gecode::Int::PC_INT_BND>(home,share,p) {}
+      /// Copy during cloning
+      virtual Gecode::Actor* copy(Gecode::Space& home, bool share) {
+        return new (home) P(home,share,*this);
+      }
+      /// Perform propagation
+      virtual Gecode::ExecStatus propagate(Gecode::Space& home,
+                                           const Gecode::ModEventDelta&) {
+        if (x0.min() == 0) {
+          GECODE_ME_CHECK(x0.gq(home,1));
+          return Gecode::ES_NOFIX;
+        }
+        if (x0.assigned())
+          return (x0.val() == 9) ?
+            Gecode::ES_FAILED : home.ES_SUBSUMED(*this);
+        return Gecode::ES_FIX;
+      }
+    };
+    /// Test space
+    class TestSpace : public Gecode::Space {
+    public:
+      /// Integer variable
+      Gecode::IntVar x;
+      /// Constructor for creation
+      TestSpace(void) : x(*this,0,9) {}
+      /// Constructor for cloning \a s
+      TestSpace(bool share, TestSpace& s) : Space(share,s) {
+        x.update(*this,share,s.x);
+      }
+      /// Post propagator in group \a g
+      void post(Gecode::PropagatorGroup g) {
+        Gecode::Home home = (*this)(g);
+        (void) new (home) P(home,x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(bool share) {
+        return new TestSpace(share,*this);
+      }
+    };
+    /// Check that the profile for group \a g has the numbers \a n
+    static bool
+    check(Gecode::PropagatorGroup g, const unsigned long long int n[4]) {
+      std::ostringstream os;
+      Gecode::profiler.print(os,Gecode::PF_CSV);
+      std::istringstream is(os.str());
+      std::string l;
+      while (std::getline(is,l)) {
+        // The name of the propagator is quoted
+        std::string::size_type q = l.rfind('"');
+        if ((q == std::string::npos) || (q+1 >= l.size()))
+          continue;
+        std::istringstream es(l.substr(q+2));
+        unsigned int gid; char c;
+        unsigned long long int v[4];
+        es >> gid >> c >> v[0] >> c >> v[1] >> c >> v[2] >> c >> v[3];
+        if (!es || (gid != g.id()))
+          continue;
+        for (int i=0; i<4; i++)
+          if (v[i] != n[i]) {
+            olog << ind(2) << "Counter " << i << " is " << v[i]
+                 << " instead of " << n[i] << std::endl;
+            return false;
+          }
+        return true;
+      }
+      olog << ind(2) << "No profile for group" << std::endl;
+      return false;
+    }
+  public:
+    /// Initialize test
+    Profiler(void) : Test::Base("Profiler") {}
+    /// Perform actual tests
+    bool run(void) {
+      using namespace Gecode;
+      {
+        // Executions of a single space
+        PropagatorGroup g;
+        TestSpace* s = new TestSpace;
+        s->post(g);
+        // Runs twice: no fixpoint after pruning, then fixpoint
+        (void) s->status();
+        rel(*s, s->x, IRT_EQ, 5);
+        // Runs once: subsumed
+        (void) s->status();
+        // Profile information is recorded when the space is deleted
+        delete s;
+        const unsigned long long int n[4] = {3ULL,1ULL,1ULL,0ULL};
+        if (!check(g,n))
+          return false;
+      }
+      {
+        // Executions are summed up over all clones
+        PropagatorGroup g;
+        TestSpace* s = new TestSpace;
+        s->post(g);
+        (void) s->status();
+        TestSpace* c = static_cast<TestSpace*>(s->clone());
+        rel(*c, c->x, IRT_EQ, 9);
+        // Runs once: failed
+        (void) c->status();
+        rel(*s, s->x, IRT_EQ, 4);
+        // Runs once: subsumed
+        (void) s->status();
+        delete s;
+        delete c;
+        const unsigned long long int n[4] = {4ULL,1ULL,1ULL,1ULL};
+        if (!check(g,n))
+          return false;
+      }
+      return true;
+    }
+  };
+
+  Profiler p;
+
+}
+
+#endif
+
+// STATISTICS: test-core
@@ -0,0 +1,122 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2017
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int.hh>
+#include <gecode/search.hh>
+
+#include "test/test.hh"
+
+namespace Test {
+
+  /// %Test for propagator scheduling policies
+  class Scheduling : public Test::Base {
+  protected:
+    /// Test space (queens puzzle)
+    class TestSpace : public Gecode::Space {
+    protected:
+      /// Queens
+      Gecode::IntVarArray q;
+    public:
+      /// Constructor for creation
+      TestSpace(int n) : q(*this,n,0,n-1) {
+        using namespace Gecode;
+        IntArgs c(n);
+        for (int i=n; i--; )
+          c[i]=i;
+        distinct(*this, q, IPL_DOM);
+        distinct(*this, c, q, IPL_BND);
+        for (int i=n; i--; )
+          c[i]=-i;
+        distinct(*this, c, q, IPL_VAL);
+        branch(*this, q, INT_VAR_SIZE_MIN(), INT_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      TestSpace(bool share, TestSpace& s) : Space(share,s) {
+        q.update(*this,share,s.q);
+      }
+      /// Copy during cloning
+      virtual Space* copy(bool share) {
+        return new TestSpace(share,*this);
+      }
+    };
+    /// Size of puzzle
+    static const int n = 7;
+    /// Count solutions for scheduling policy \a sp
+    unsigned int solutions(const Gecode::SchedulingPolicy* sp,
+                           Gecode::Search::Statistics& stat) {
+      Gecode::Search::Options o;
+      o.scheduling = sp;
+      TestSpace* s = new TestSpace(n);
+      Gecode::DFS<TestSpace> e(s,o);
+      unsigned int m = 0;
+      while (TestSpace* t = e.next()) {
+        delete t; m++;
+      }
+      stat = e.statistics();
+      return m;
+    }
+  public:
+    /// Initialize test
+    Scheduling(void) : Test::Base("Kernel::Scheduling") {}
+    /// Perform actual tests
+    bool run(void) {
+      using namespace Gecode;
+      Search::Statistics stat;
+      unsigned int m = solutions(NULL,stat);
+      // Create random policy
+      SchedulingPolicy sp;
+      for (int i=PropCost::AC_RECORD+1; i<=PropCost::AC_MAX; i++) {
+        sp.queue[i] = static_cast<PropCost::ActualCost>
+          (PropCost::AC_RECORD+1+rand(PropCost::AC_MAX));
+        sp.lifo[i] = (rand(2) == 0);
+      }
+      sp.afc_promote = (rand(2) == 0) ? 0.0 : 1.0 + rand(4);
+      if (solutions(&sp,stat) != m)
+        return false;
+      // Per-queue counters must add up
+      unsigned long int p = 0;
+      for (int i=0; i<=PropCost::AC_MAX; i++)
+        p += stat.propagate_queue[i];
+      return p == stat.propagate;
+    }
+  };
+
+  Scheduling scheduling;
+
+}
+
+// STATISTICS: test-core
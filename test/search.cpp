@@ -40,6 +40,14 @@
 
 #include "test/test.hh"
 
+#ifdef GECODE_HAS_DISTRIBUTED
+#include <cstdlib>
+#include <cstring>
+
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
 namespace Test {
 
   /// Tests for search engines
@@ -438,6 +446,89 @@ namespace Test {
       }
     };
 
+    /// %Test for embarrassingly parallel depth-first search
+    template<class Model>
+    class EPS : public Test {
+    private:
+      /// Number of subproblems per thread
+      unsigned int e;
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      EPS(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+          unsigned int e0, unsigned int t0)
+        : Test("EPS::"+Model::name()+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
+               str(e0)+"::"+str(t0),
+               htb1,htb2,htb3), e(e0), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.eps = e;
+        o.threads = t;
+        o.stop = &f;
+        Gecode::DFS<Model> dfs(m,o);
+        int n = m->solutions();
+        delete m;
+        while (true) {
+          Model* s = dfs.next();
+          if (s != NULL) {
+            n--; delete s;
+          }
+          if ((s == NULL) && !dfs.stopped())
+            break;
+          f.limit(f.limit()+2);
+        }
+        return n == 0;
+      }
+    };
+
+    /// %Test for searching archived subproblems one by one
+    template<class Model>
+    class Subproblems : public Test {
+    private:
+      /// Number of subproblems
+      unsigned int e;
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      Subproblems(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+                  unsigned int e0, unsigned int t0)
+        : Test("Subproblems::"+Model::name()+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
+               str(e0)+"::"+str(t0),
+               htb1,htb2,htb3), e(e0), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3);
+        int n = m->solutions();
+        Gecode::Archive a;
+        {
+          Gecode::Search::Subproblems sp;
+          sp.decompose(*m,e,Gecode::Search::Config::eps_depth);
+          sp.archive(a);
+        }
+        Gecode::Search::Subproblems sp(a);
+        for (int i=0; i<sp.size(); i++) {
+          Gecode::Search::Subproblems spi;
+          spi.add(sp[i]);
+          Gecode::Search::Options o;
+          o.threads = t;
+          o.subproblems = &spi;
+          Gecode::DFS<Model> dfs(m,o);
+          while (Model* s = dfs.next()) {
+            n--; delete s;
+          }
+        }
+        delete m;
+        return n == 0;
+      }
+    };
+
     /// %Test for best solution search
     template<class Model>
     class BAB : public Test {
@@ -576,6 +667,81 @@ namespace Test {
       }
     };
 
+#ifdef GECODE_HAS_DISTRIBUTED
+    /// %Test for distributed search
+    template<class Model, template<class> class Engine>
+    class DIS : public Test {
+    private:
+      /// Number of worker processes
+      unsigned int p;
+    public:
+      /// Initialize test
+      DIS(const std::string& e, HowToConstrain htc,
+          HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+          unsigned int p0)
+        : Test("DIS::"+e+"::"+Model::name()+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+str(p0),
+               htb1,htb2,htb3,htc), p(p0) {}
+      /// Return Unix-domain socket path unique to this process
+      static std::string address(void) {
+        static unsigned int n = 0;
+        const char* t = getenv("TMPDIR");
+        std::string d = ((t != NULL) && (strlen(t) < 64)) ? t : "/tmp";
+        return d+"/gecode-test-dis-"+
+          str(static_cast<unsigned int>(getpid()))+"-"+str(n++);
+      }
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        if (Gecode::DIS<Model,Engine>::worker()) {
+          // Started by the coordinator (see below)
+          bool ok = true;
+          try {
+            (void) Gecode::DIS<Model,Engine>::work(m,Gecode::Search::Options());
+          } catch (Gecode::Search::CommunicationFailed&) {
+            ok = false;
+          }
+          delete m;
+          return ok;
+        }
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.processes = p;
+        // The workers run this very test in a process of their own
+        const char* c[] = {opt.program, "-worker", name().c_str(), NULL};
+        o.command = c;
+        // With one worker, use an address of the test's own
+        std::string a = address();
+        o.address = (p == 1) ? a.c_str() : NULL;
+        o.stop = &f;
+        int n = m->solutions();
+        Model* b = NULL;
+        bool ok;
+        try {
+          Gecode::DIS<Model,Engine> dis(m,o);
+          while (true) {
+            Model* s = dis.next();
+            if (s != NULL) {
+              n--; delete b; b=s;
+            }
+            if ((s == NULL) && !dis.stopped())
+              break;
+            f.limit(f.limit()+2);
+          }
+          ok = Gecode::DIS<Model,Engine>::best ?
+            ((b == NULL) || b->best()) : (n == 0);
+        } catch (Gecode::Search::CommunicationFailed& e) {
+          olog << ind(2) << "Communication failed: " << e.what()
+               << std::endl;
+          ok = false;
+        }
+        delete m;
+        delete b;
+        return ok;
+      }
+    };
+#endif
+
     /// %Test for portfolio-based search using SEBs
     template<class Model>
     class SEBPBS : public Test {
@@ -727,6 +893,26 @@ namespace Test {
                                     c_d, a_d, t);
             }
 
+        // Embarrassingly parallel depth-first search
+        for (unsigned int t = 1; t<=4; t++)
+          for (unsigned int e = 1; e<=16; e *= 4) {
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2)
+                for (BranchTypes htb3; htb3(); ++htb3) {
+                  (void) new EPS<HasSolutions>
+                    (htb1.htb(),htb2.htb(),htb3.htb(),e,t);
+                  (void) new Subproblems<HasSolutions>
+                    (htb1.htb(),htb2.htb(),htb3.htb(),e*t,t);
+                }
+            (void) new EPS<FailImmediate>(HTB_NONE, HTB_NONE, HTB_NONE, e, t);
+            (void) new EPS<SolveImmediate>(HTB_NONE, HTB_NONE, HTB_NONE, e, t);
+            (void) new EPS<HasSolutions>(HTB_NONE, HTB_NONE, HTB_NONE, e, t);
+            (void) new Subproblems<FailImmediate>
+              (HTB_NONE, HTB_NONE, HTB_NONE, e*t, t);
+            (void) new Subproblems<SolveImmediate>
+              (HTB_NONE, HTB_NONE, HTB_NONE, e*t, t);
+          }
+
         // Limited discrepancy search
         for (unsigned int t = 1; t<=4; t++) {
           for (BranchTypes htb1; htb1(); ++htb1)
@@ -782,6 +968,28 @@ namespace Test {
             (void) new PBS<SolveImmediate,Gecode::LDS>("LDS",false,a,t);
             (void) new PBS<SolveImmediate,Gecode::BAB>("BAB",true,a,t);
           }
+#ifdef GECODE_HAS_DISTRIBUTED
+        // Distributed search
+        for (unsigned int p=1; p<=3; p++) {
+          for (BranchTypes htb1; htb1(); ++htb1)
+            for (BranchTypes htb2; htb2(); ++htb2)
+              (void) new DIS<HasSolutions,Gecode::DFS>
+                ("DFS",HTC_NONE,htb1.htb(),htb2.htb(),HTB_BINARY,p);
+          // Only lexical constraints have a unique best solution
+          (void) new DIS<HasSolutions,Gecode::BAB>
+            ("BAB",HTC_LEX_LE,HTB_BINARY,HTB_BINARY,HTB_BINARY,p);
+          (void) new DIS<HasSolutions,Gecode::BAB>
+            ("BAB",HTC_LEX_GR,HTB_BINARY,HTB_BINARY,HTB_BINARY,p);
+          (void) new DIS<FailImmediate,Gecode::DFS>
+            ("DFS",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,p);
+          (void) new DIS<SolveImmediate,Gecode::DFS>
+            ("DFS",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,p);
+          (void) new DIS<FailImmediate,Gecode::BAB>
+            ("BAB",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,p);
+          (void) new DIS<SolveImmediate,Gecode::BAB>
+            ("BAB",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,p);
+        }
+#endif
         // Portfolio-based search using SEBs
         for (unsigned int mt=1; mt<=3; mt += 2)
           for (unsigned int st=1; st<=2; st++) {
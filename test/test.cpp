@@ -119,9 +119,11 @@ namespace Test {
   std::vector<std::pair<MatchType, const char*> > testpat;
   const char* startFrom = NULL;
   bool list = false;
+  const char* worker = NULL;
 
   void
   Options::parse(int argc, char* argv[]) {
+    program = argv[0];
     int i = 1;
     while (i < argc) {
       if (!strcmp(argv[i],"-help") || !strcmp(argv[i],"--help")) {
@@ -159,6 +161,9 @@ namespace Test {
                   << "\t\tstop on first error or continue" << std::endl
                   << "\t-list" << std::endl
                   << "\t\toutput list of all test cases and exit" << std::endl
+                  << "\t-worker (string) default: (none)" << std::endl
+                  << "\t\trun test case once without output (as worker process)"
+                  << std::endl
           ;
         exit(EXIT_SUCCESS);
       } else if (!strcmp(argv[i],"-seed")) {
@@ -196,6 +201,9 @@ namespace Test {
         }
       } else if (!strcmp(argv[i],"-list")) {
         list = true;
+      } else if (!strcmp(argv[i],"-worker")) {
+        if (++i == argc) goto missing;
+        worker = argv[i];
       }
       i++;
     }
@@ -228,6 +236,13 @@ main(int argc, char* argv[]) {
 
   Base::rand.seed(opt.seed);
 
+  if (worker != NULL) {
+    for (Base* t = Base::tests() ; t != NULL; t = t->next() )
+      if (t->name() == worker)
+        return t->run() ? EXIT_SUCCESS : EXIT_FAILURE;
+    return EXIT_FAILURE;
+  }
+
   bool started = startFrom == NULL ? true : false;
 
   for (Base* t = Base::tests() ; t != NULL; t = t->next() ) {
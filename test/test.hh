@@ -93,6 +93,8 @@ namespace Test {
     bool stop;
     /// Whether to log the tests
     bool log;
+    /// Name of the program running the tests
+    const char* program;
 
     /// Initialize options with defaults
     Options(void);
@@ -43,7 +43,8 @@ namespace Test {
    */
   inline
   Options::Options(void)
-    : seed(0), iter(defiter), fixprob(deffixprob), stop(true), log(false)
+    : seed(0), iter(defiter), fixprob(deffixprob), stop(true), log(false),
+      program(NULL)
   {}
 
   /*
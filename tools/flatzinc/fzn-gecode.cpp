@@ -89,6 +89,18 @@ int main(int argc, char** argv) {
       exit(EXIT_FAILURE);
     }
     delete fg;
+#ifdef GECODE_PROPAGATION_PROFILER
+    if (opt.profile_file()) {
+      std::ofstream os(opt.profile_file());
+      if (!os.good()) {
+        std::cerr << "Could not open file " << opt.profile_file()
+                  << " for profile." << std::endl;
+        exit(EXIT_FAILURE);
+      }
+      profiler.print(os, opt.profile_format());
+      os.close();
+    }
+#endif
   } catch (FlatZinc::Error& e) {
     std::cerr << "Error: " << e.toString() << std::endl;
     return 1;